@@ -28,6 +28,7 @@ core: [
 
     ; (C)ore
     c-bind.c
+    c-bytecode.c
     c-do.c
     c-context.c
     c-error.c
@@ -412,6 +412,7 @@ standard: construct [] [
         made-blocks:
         made-objects:
         recycles:
+        series-compacted:
             _
     ]
 
@@ -370,3 +370,24 @@ source
 library-path
 runtime-path
 options
+
+; STATS/GC, see Make_GC_Stats_Array()
+recycles
+compacted
+pause
+p50
+p99
+max
+history
+kind
+full
+minor
+sliced
+mark
+sweep
+marked
+live
+freed
+reclaimed
+ballast
+pools
@@ -1135,6 +1135,7 @@ void Startup_Core(void)
 
     Startup_Pools(0);          // Memory allocator
     Startup_GC();
+    Startup_Bytecode();
 
 //==//////////////////////////////////////////////////////////////////////==//
 //
@@ -1278,6 +1279,12 @@ void Startup_Core(void)
     MANAGE_ARRAY(actions_catalog);
     PUSH_GUARD_ARRAY(actions_catalog);
 
+    // Fast paths for common actions and natives on INTEGER! and DECIMAL!,
+    // registered before any copies of those functions get made.
+    //
+    Startup_Integer_Entries();
+    Startup_Decimal_Entries();
+
     // boot->errors is the error definition list from %errors.r
     //
     REBCTX *errors_catalog = Startup_Errors(VAL_ARRAY(&boot->errors));
@@ -1480,6 +1487,7 @@ void Shutdown_Core(void)
     assert(!Saved_State);
 
     Shutdown_Stacks();
+    Shutdown_Profiler();
 
     // Run Recycle, but the TRUE flag indicates we want every series
     // that is managed to be freed.  (Only unmanaged should be left.)
@@ -1503,6 +1511,7 @@ void Shutdown_Core(void)
     Shutdown_Symbols();
     Shutdown_Interning();
 
+    Shutdown_Bytecode();
     Shutdown_GC();
 
     // !!! Need to review the relationship between Open_StdIO (which the host
@@ -130,6 +130,7 @@ void Bind_Values_Core(
 ) {
     struct Reb_Binder binder;
     INIT_BINDER(&binder);
+    Size_Binder(&binder, CTX_LEN(context));
 
     // Via the global hash table, each spelling of the word can find the
     // canon form of the word.  Associate that with an index number to signal
@@ -141,6 +142,11 @@ void Bind_Values_Core(
         if (NOT_VAL_FLAG(key, TYPESET_FLAG_UNBINDABLE))
             Add_Binder_Index(&binder, VAL_KEY_CANON(key), index);
 
+    // !!! Binding doesn't heed SERIES_INFO_FROZEN, so the words being bound
+    // may live in an old frozen array which minor recycles won't rescan.
+    //
+    GC_Barrier_Node(NOD(CTX_VARLIST(context)));
+
     Bind_Values_Inner_Loop(
         &binder, head, context, bind_types, add_midstream_types, flags
     );
@@ -285,6 +291,7 @@ REBARR *Copy_And_Bind_Relative_Deep_Managed(
 
     struct Reb_Binder binder;
     INIT_BINDER(&binder);
+    Size_Binder(&binder, ARR_LEN(paramlist) - 1);
 
     // Setup binding table from the argument word list
     //
@@ -0,0 +1,2797 @@
+//
+//  File: %c-bytecode.c
+//  Summary: "register bytecode for frequently called function bodies"
+//  Section: core
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2012 REBOL Technologies
+// Copyright 2012-2017 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// The body of a FUNC is run by Do_Core() each time the function is called,
+// which means rediscovering on every call that `x` is an argument, that `+`
+// is an enfix operator taking a tight right hand side, and that `if` is the
+// IF native taking a condition and a block.  Once a body has been called
+// BYTECODE_THRESHOLD times, it is looked at here and as much of it as is
+// understood gets translated into instructions for a simple register
+// machine, which are run by Run_Bytecode_Throws() instead.
+//
+// The translation is done one "statement" (what a DO/NEXT would consume) at
+// a time.  The shape of a statement depends on what its words looked up to
+// when it was compiled, so each compiled statement starts with a list of
+// guards: a word is still not a function, still a function taking the same
+// number of normal arguments, still the IF native, etc.  If any guard fails
+// the statement is run with DO/NEXT instead, as is any statement that the
+// compiler didn't understand.  Hence nothing about the semantics changes:
+//
+// * Words that are arguments or locals of the function are fetched by their
+//   index in the frame, as Get_Var_Core() would find them.
+//
+// * Calls to functions that only take normal arguments are made through a
+//   frame built like APPLY builds one, without going back through Do_Core()
+//   to gather the arguments.  What the function value was found to be is
+//   remembered until the next recycle (see GC_Epoch), so the guard is
+//   usually just a pointer comparison.
+//
+// * IF, EITHER, LOOP and WHILE with literal blocks are turned into jumps,
+//   and BREAK and CONTINUE are caught by the loop they are in.  Their
+//   branches and bodies are compiled along with the statement.
+//
+// * A call whose result is the result of the body--the last statement of
+//   the body, or the argument of a RETURN--reuses the frame of the body for
+//   the call when it can, so recursion in those positions runs in constant
+//   C stack and frame stack.  See Try_Tail_Call().
+//
+// * A call from a compiled body to another compiled body doesn't nest a
+//   Do_Core() and dispatcher on the C stack.  The frame for the call is put
+//   in a heap-allocated continuation and the same Run_Bytecode_Throws() runs
+//   the called body, returning to the caller's instructions when it's done.
+//   So recursion between compiled bodies isn't limited by the C stack, only
+//   by the data stack the registers are on (see STACK_LIMIT).
+//
+// * There are no frames for where a compiled body is, or for the IF, EITHER,
+//   LOOP and WHILE it runs inline.  Errors raised from it get their NEAR,
+//   WHERE and line from what is running instead (see Reb_Bytecode_Run), so
+//   they are the same as the evaluator's.
+//
+// * Function bodies are deep frozen, so the compiled form can't go stale
+//   from the body being modified.  The compiled form is kept until GC frees
+//   the body array (see ARRAY_INFO_BYTECODE).
+//
+// The evaluator looks up each word of a statement when it gets to it, so
+// code run by a statement can change the meaning of the words after it, as
+// in `foo (foo: :print ...) x`.  Guards are checked before such code runs,
+// so a statement is only compiled if its words are used where no code could
+// have run since the last check:
+//
+// * A word looked up after a call (or a GROUP! setting a word) makes the
+//   statement not compiled, unless it's an operator continuing the
+//   statement's expression, e.g. the `+` of `(f x) + 1`.  A BC_CHECK of the
+//   guards from there on is put before such an operator, and if one fails,
+//   the evaluator continues the expression from the operator.
+//
+// * Math and comparisons done by Quick_Binary_Op() don't count as calls.  If
+//   one followed by such a word can't be done that way, the statement is run
+//   by the evaluator from its start (or from its last check) instead.  As
+//   nothing else had run, this doesn't show.
+//
+// * A function whose arguments run code is called as what its word looked
+//   up to before the arguments, which is fetched into a register for it.
+//
+
+#include "sys-core.h"
+
+#define BYTECODE_THRESHOLD 16 // calls before a body is compiled
+#define BYTECODE_BUCKETS 256 // hash table of compiled bodies
+#define CALL_COUNTERS 256 // direct-mapped call counts of uncompiled bodies
+#define MAX_CALL_ARGS 8 // functions taking more are left to Do_Core()
+
+enum Reb_Bytecode_Op {
+    BC_STMT, // check guards, else fall back (b = next statement, c = end)
+    BC_FALLBACK, // use DO/NEXT from index (b = next statement, c = end)
+    BC_CHECK, // check guards, else evaluate from op at index (b = statement)
+    BC_FETCH, // dest := function at index, to call after its arguments
+    BC_LITERAL, // dest := inert value at index
+    BC_GET, // dest := value of WORD! at index (not a function)
+    BC_GET_OPT, // dest := value of GET-WORD! at index
+    BC_LIT_WORD, // dest := LIT-WORD! at index as a WORD!
+    BC_SET, // variable of SET-WORD! at index := a
+    BC_CALL, // dest := call function at index with b arguments from a...
+    BC_TAIL_CALL, // BC_CALL, but reuse the frame for it if possible
+    BC_ENFIX, // dest := op at index on a and b (c = kind, d = see Note_Op)
+    BC_VOID, // dest := void
+    BC_BLANKIFY, // dest := blank if void, as Run_Branch_Throws() does
+    BC_TRUTHIFY, // dest := bar if falsey, see R_OUT_VOID_IF_UNWRITTEN_TRUTHIFY
+    BC_JUMP, // go to c
+    BC_IF_FALSE, // go to b if a isn't conditionally true
+    BC_LOOP_START, // start LOOP counting down from a in b, or go to c
+    BC_LOOP_NEXT, // count down b and go to c if any are left
+    BC_WHILE_START, // start WHILE, b is set when the body ran
+    BC_WHILE_TEST, // go to c if the condition in a is falsey
+    BC_WHILE_NEXT, // note body ran, go to c
+    BC_WHILE_FINISH, // dest := result of WHILE whose condition went falsey
+    BC_END // result of the body is in register 0
+};
+
+// Instructions and guards refer to source values by array and index, and not
+// with a RELVAL*, since RECYCLE/COMPACT may move the data of frozen arrays.
+//
+struct Reb_Insn {
+    REBCNT op;
+    REBCNT dest;
+    REBCNT a;
+    REBCNT b;
+    REBCNT c;
+    REBCNT d;
+    REBCNT loop; // LOOP_START or WHILE_START catching throws, or NOT_FOUND
+    REBCNT slot; // frame index of a relative word at `index`, else 0
+    REBARR *array;
+    REBCNT index;
+    REBCNT end; // index in `array` past the expression, for errors
+    REBCNT ctl; // IF, EITHER, LOOP or WHILE this is inside of, or NOT_FOUND
+    REBCNT block; // index in `array` of a literal branch or body block
+    REBCNT fn; // register the function was fetched into, or NOT_FOUND
+    REBFUN *fun; // native of a control word
+};
+
+enum Reb_Guard_Kind {
+    GUARD_TERM, // looks up to something that isn't a function
+    GUARD_NOT_ENFIX, // looks up to something that isn't an enfix function
+    GUARD_CALL, // function taking `arg` normal arguments
+    GUARD_OP, // enfix function of kind `arg`
+    GUARD_NATIVE // is the (non-enfix) native `fun`
+};
+
+struct Reb_Guard {
+    REBCNT kind;
+    REBCNT arg;
+    REBCNT slot;
+    REBARR *array;
+    REBCNT index;
+    REBFUN *fun;
+    REBUPT epoch;
+};
+
+enum {
+    OP_KIND_NONE, // not an enfix function
+    OP_KIND_TIGHT, // like `+`, right hand side is a single term
+    OP_KIND_DEFERRED, // like `=`, right hand side may be a call
+    OP_KIND_OTHER // any other enfix function, not compiled
+};
+
+struct Reb_Bytecode {
+    REBARR *body;
+    struct Reb_Bytecode *next; // in the same bucket of Bytecode_Table
+    struct Reb_Insn *insns; // NULL if no statement of the body compiled
+    REBCNT num_insns;
+    struct Reb_Guard *guards;
+    REBCNT num_guards;
+    REBCNT num_regs;
+};
+
+struct Reb_Call_Counter {
+    REBARR *body;
+    REBCNT count;
+};
+
+// A call being run by the Run_Bytecode_Throws() of its caller.  These are
+// kept in a stack which only grows, with TG_Continuation being the top one
+// in use.  A fail() goes back to the top at the time of its PUSH_TRAP, in
+// the same way as the chunk stack (see Snap_State_Core()).
+//
+struct Reb_Continuation {
+    REBFRM frame; // needs a stable address, as the frame stack links it
+    struct Reb_Bytecode *code; // of the caller
+    REBCNT pc; // of the caller's BC_CALL
+    REBDSP base; // of the caller's registers
+    struct Reb_Continuation *prior;
+    struct Reb_Continuation *next; // kept for reuse when this one is popped
+};
+
+// A Run_Bytecode_Throws() in progress, and which frame it is running at
+// what instruction.  The frames it runs don't have their position in the
+// body as Do_Core() frames do, so errors get it from here (see
+// Get_Compiled_Position()).  Like a continuation, a fail() goes back to the
+// one at the time of its PUSH_TRAP.
+//
+struct Reb_Bytecode_Run {
+    REBFRM *base; // the frame it was called with
+    REBFRM *f; // the frame running now, in a continuation if not `base`
+    struct Reb_Bytecode *code;
+    REBCNT pc; // NOT_FOUND if not at an instruction of `code`
+    struct Reb_Continuation *cont_base;
+    struct Reb_Bytecode_Run *prior;
+};
+
+static struct Reb_Bytecode *Bytecode_Table[BYTECODE_BUCKETS];
+static struct Reb_Call_Counter Call_Counters[CALL_COUNTERS];
+static struct Reb_Continuation *Continuations; // bottom of the stack
+
+#define BODY_HASH(body,n) \
+    ((cast(REBUPT, (body)) >> 4) % (n))
+
+inline static struct Reb_Bytecode *Find_Bytecode(REBARR *body) {
+    assert(GET_SER_INFO(body, ARRAY_INFO_BYTECODE));
+    struct Reb_Bytecode *code
+        = Bytecode_Table[BODY_HASH(body, BYTECODE_BUCKETS)];
+    while (code->body != body)
+        code = code->next;
+    return code;
+}
+
+
+//=//// SHAPES OF FUNCTIONS ///////////////////////////////////////////////=//
+
+// Number of arguments of `pclass` which `fun` takes from the callsite, if
+// all of its parameters before the first refinement are of that class (or
+// are locals).  Parameters after a refinement are left void by a call with
+// no refinements.  NOT_FOUND if the function can't be called that way.
+//
+static REBCNT Count_Args(REBFUN *fun, enum Reb_Param_Class pclass)
+{
+    if (FUNC_EXEMPLAR(fun) != NULL || GET_FUN_FLAG(fun, FUNC_FLAG_INVISIBLE))
+        return NOT_FOUND;
+
+    REBCNT count = 0;
+    REBVAL *param = FUNC_FACADE_HEAD(fun);
+    for (; NOT_END(param); ++param) {
+        switch (VAL_PARAM_CLASS(param)) {
+        case PARAM_CLASS_LOCAL:
+        case PARAM_CLASS_RETURN:
+        case PARAM_CLASS_LEAVE:
+            continue;
+
+        case PARAM_CLASS_REFINEMENT:
+            return count;
+
+        default:
+            if (
+                VAL_PARAM_CLASS(param) != pclass
+                || GET_VAL_FLAG(param, TYPESET_FLAG_HIDDEN)
+                || GET_VAL_FLAG(param, TYPESET_FLAG_VARIADIC)
+            ){
+                return NOT_FOUND;
+            }
+            ++count;
+        }
+    }
+    return count;
+}
+
+inline static REBCNT Call_Arity(REBFUN *fun) {
+    REBCNT arity = Count_Args(fun, PARAM_CLASS_NORMAL);
+    return arity > MAX_CALL_ARGS ? NOT_FOUND : arity; // NOT_FOUND is big
+}
+
+static REBCNT Op_Kind(REBFUN *fun)
+{
+    if (GET_FUN_FLAG(fun, FUNC_FLAG_DEFERS_LOOKBACK)) {
+        if (Count_Args(fun, PARAM_CLASS_NORMAL) == 2)
+            return OP_KIND_DEFERRED;
+    }
+    else if (Count_Args(fun, PARAM_CLASS_TIGHT) == 2)
+        return OP_KIND_TIGHT;
+
+    return OP_KIND_OTHER;
+}
+
+
+// Test that `var` looks up to a function of the kind a GUARD_CALL or
+// GUARD_OP expects.  The function that passed is remembered in `*fun`, so
+// the next test of the same function is just a comparison--good until the
+// next recycle, which might free it and let another function take its place.
+//
+static REBOOL Var_Fits(
+    const REBVAL *var,
+    REBCNT kind,
+    REBCNT arg,
+    REBFUN **fun,
+    REBUPT *epoch
+){
+    if (IS_END(var) || NOT(IS_FUNCTION(var)))
+        return FALSE;
+
+    REBOOL enfixed = GET_VAL_FLAG(var, VALUE_FLAG_ENFIXED);
+    if (kind == GUARD_OP ? NOT(enfixed) : enfixed)
+        return FALSE;
+
+    if (VAL_FUNC(var) == *fun && *epoch == GC_Epoch)
+        return TRUE;
+
+    if (kind == GUARD_OP) {
+        if (Op_Kind(VAL_FUNC(var)) != arg)
+            return FALSE;
+    }
+    else if (Call_Arity(VAL_FUNC(var)) != arg)
+        return FALSE;
+
+    *fun = VAL_FUNC(var);
+    *epoch = GC_Epoch;
+    return TRUE;
+}
+
+
+//=//// RUNNING ///////////////////////////////////////////////////////////=//
+
+#define REG(n) \
+    DS_AT(base + 1 + (n)) // data stack may move, so always recalculate
+
+inline static void Move_Keep_Unevaluated(REBVAL *out, const REBVAL *v) {
+    Move_Value(out, v);
+    if (GET_VAL_FLAG(v, VALUE_FLAG_UNEVALUATED))
+        SET_VAL_FLAG(out, VALUE_FLAG_UNEVALUATED);
+}
+
+inline static const REBVAL *Var_At(
+    REBFRM *f,
+    REBCNT slot,
+    REBARR *array,
+    REBCNT index
+){
+    if (slot != 0)
+        return FRM_ARG(f, slot);
+    return Get_Opt_Var_Else_End(ARR_AT(array, index), AS_SPECIFIER(f));
+}
+
+// The function a call or enfix instruction `i` runs.  If no BC_FETCH got it
+// before the arguments, nothing could have run since its word was looked up
+// by the statement's guards, so it's what the word looks up to now.
+//
+#define INSN_FUN(f,i) \
+    ((i)->fn != NOT_FOUND \
+        ? REG((i)->fn) \
+        : Var_At((f), (i)->slot, (i)->array, (i)->index))
+
+
+static REBOOL Guard_Holds(REBFRM *f, struct Reb_Guard *g)
+{
+    const REBVAL *var = Var_At(f, g->slot, g->array, g->index);
+
+    switch (g->kind) {
+    case GUARD_TERM:
+        return LOGICAL(NOT_END(var) && NOT(IS_FUNCTION(var)));
+
+    case GUARD_NOT_ENFIX:
+        return LOGICAL(
+            IS_END(var)
+            || NOT(IS_FUNCTION(var))
+            || NOT_VAL_FLAG(var, VALUE_FLAG_ENFIXED)
+        );
+
+    case GUARD_NATIVE:
+        return LOGICAL(
+            NOT_END(var)
+            && IS_FUNCTION(var)
+            && VAL_FUNC(var) == g->fun
+            && NOT_VAL_FLAG(var, VALUE_FLAG_ENFIXED)
+        );
+
+    default:
+        return Var_Fits(var, g->kind, g->arg, &g->fun, &g->epoch);
+    }
+}
+
+
+// Arguments for the normal (or #tight) parameters of `fun` come from `argv`,
+// and any other parameters are void.
+//
+static void Fill_Args(REBVAL *arg, REBFUN *fun, REBVAL * const argv[])
+{
+    REBVAL *param = FUNC_FACADE_HEAD(fun);
+    REBVAL * const *argp = argv;
+    REBOOL refinements = FALSE;
+    for (; NOT_END(param); ++param, ++arg) {
+        Prep_Stack_Cell(arg);
+
+        enum Reb_Param_Class pclass = VAL_PARAM_CLASS(param);
+        if (pclass == PARAM_CLASS_REFINEMENT)
+            refinements = TRUE;
+
+        if (
+            NOT(refinements)
+            && (pclass == PARAM_CLASS_NORMAL || pclass == PARAM_CLASS_TIGHT)
+        ){
+            Move_Keep_Unevaluated(arg, *argp);
+            ++argp;
+        }
+        else
+            Init_Void(arg);
+    }
+}
+
+
+// Push frame `f` for a call to `fun_value`, with arguments for its normal
+// (or #tight) parameters from `argv` as in Fill_Args().  The arguments are
+// not checked yet.
+//
+static void Push_Call_Frame(
+    REBFRM *f,
+    REBVAL *out,
+    const REBVAL *fun_value,
+    REBSTR *opt_label,
+    REBVAL * const argv[]
+){
+    f->out = out;
+
+    f->source.index = 0;
+    f->source.vaptr = NULL;
+    f->source.array = EMPTY_ARRAY; // for setting HOLD flag in Push_Frame
+    TRASH_POINTER_IF_DEBUG(f->source.pending);
+
+    f->gotten = END;
+    SET_FRAME_VALUE(f, END);
+    f->specifier = SPECIFIED;
+
+    Init_Endlike_Header(&f->flags, DO_FLAG_APPLYING);
+
+    Push_Frame_Core(f);
+
+    Push_Function(f, opt_label, VAL_FUNC(fun_value), VAL_BINDING(fun_value));
+    f->param = FUNC_FACADE_HEAD(f->phase); // fulfilling until Check_Args()
+    f->refine = NULL;
+    assert(f->special == NULL); // Count_Args() rules out exemplars
+
+    Fill_Args(f->args_head, f->phase, argv);
+}
+
+
+// Call `fun_value` with arguments for its normal (or #tight) parameters from
+// `argv`, and any others void.  The frame is filled in and then checked the
+// way Apply_Def_Or_Exemplar() does it for APPLY.
+//
+static REBOOL Apply_Args_Throws(
+    REBVAL *out,
+    const REBVAL *fun_value,
+    REBSTR *opt_label,
+    REBVAL * const argv[]
+){
+    DECLARE_FRAME (f);
+    Push_Call_Frame(f, out, fun_value, opt_label, argv);
+
+    f->special = f->args_head; // only type check, see Apply_Def_Or_Exemplar
+
+    (*PG_Do)(f);
+
+    Drop_Frame_Core(f);
+
+    return THROWN(out);
+}
+
+
+// Types the body of an interpreted function can give back from its call, or
+// FALSE if the function isn't one whose body is run by Do_Body_Throws().
+//
+static REBOOL Get_Result_Types(REBU64 *types, REBFUN *fun)
+{
+    REBNAT dispatcher = FUNC_DISPATCHER(fun);
+    if (dispatcher == &Unchecked_Dispatcher)
+        *types = ALL_64;
+    else if (dispatcher == &Voider_Dispatcher)
+        *types = FLAGIT_KIND(REB_MAX_VOID);
+    else if (dispatcher == &Returner_Dispatcher)
+        *types = VAL_TYPESET_BITS(FUNC_PARAM(fun, FUNC_NUM_PARAMS(fun)));
+    else
+        return FALSE;
+    return TRUE;
+}
+
+
+// A call in tail position can be run by switching frame `f` over to the
+// called function and having Do_Core() redo the frame, instead of nesting a
+// new frame.  That can only be done if:
+//
+// * Nothing has a reference to the frame's variables (or a FRAME! for it),
+//   which would be the case if it had a varlist.
+//
+// * The frame is just running the body of its function--not as a phase of
+//   an ADAPT, or with functions of a CHAIN still to run on the data stack.
+//
+// * The called function is also interpreted, and whatever it can return
+//   would get through the check the frame's function would have done on
+//   the result.  (A PROCEDURE voids its result, so can only tail call one.)
+//
+// * In the case of `return foo ...`, the RETURN (`opt_return`) is this
+//   frame's own.
+//
+// If so, the frame is switched over to the function, with the arguments
+// from `argv`, and TRUE is returned.
+//
+static REBOOL Try_Tail_Call(
+    REBFRM *f,
+    REBDSP dsp_orig,
+    const REBVAL *fun_value,
+    REBSTR *opt_label,
+    REBVAL * const argv[],
+    const REBVAL *opt_return
+){
+    if (
+        f->varlist != NULL
+        || f->phase != f->original
+        || dsp_orig != f->dsp_orig
+    ){
+        return FALSE;
+    }
+
+    if (opt_return != NULL) {
+        if (
+            NOT(IS_FUNCTION(opt_return))
+            || VAL_FUNC(opt_return) != NAT_FUNC(return)
+            || VAL_BINDING(opt_return) != NOD(f)
+        ){
+            return FALSE;
+        }
+    }
+
+    REBFUN *fun = VAL_FUNC(fun_value);
+    REBU64 types;
+    if (NOT(Get_Result_Types(&types, fun)))
+        return FALSE;
+
+    if (fun != f->phase) {
+        REBU64 accepted;
+        if (NOT(Get_Result_Types(&accepted, f->phase)))
+            return FALSE;
+
+        if (FUNC_DISPATCHER(f->phase) == &Voider_Dispatcher) {
+            if (FUNC_DISPATCHER(fun) != &Voider_Dispatcher)
+                return FALSE;
+        }
+        else if (types & ~accepted)
+            return FALSE;
+    }
+
+    // The args chunk is on top of the chunk stack, as all the calls made by
+    // the body have finished.  Only resize it if the count differs.
+    //
+    REBCNT num_args = FUNC_FACADE_NUM_PARAMS(fun);
+    if (num_args != CHUNK_LEN_FROM_VALUES(f->args_head)) {
+        assert(CHUNK_FROM_VALUES(f->args_head) == TG_Top_Chunk);
+        Drop_Chunk_Of_Values(f->args_head);
+        f->args_head = Push_Value_Chunk_Of_Length(num_args);
+    }
+    Fill_Args(f->args_head, fun, argv);
+
+    f->original = f->phase = fun;
+    f->binding = VAL_BINDING(fun_value);
+    f->opt_label = opt_label;
+#if !defined(NDEBUG)
+    f->label_utf8 = cast(const char*, Frame_Label_Or_Anonymous_UTF8(f));
+#endif
+    return TRUE;
+}
+
+
+// The compiled body of `fun`, if a call to it can be run by the caller's
+// Run_Bytecode_Throws() in a continuation.  That's if it has been compiled,
+// and Check_Args() can do what Do_Core() would do with its arguments.
+//
+static struct Reb_Bytecode *Trampoline_Code(REBFUN *fun)
+{
+    REBNAT dispatcher = FUNC_DISPATCHER(fun);
+    if (
+        dispatcher != &Unchecked_Dispatcher
+        && dispatcher != &Voider_Dispatcher
+        && dispatcher != &Returner_Dispatcher
+    ){
+        return NULL;
+    }
+
+    REBARR *body = VAL_ARRAY(FUNC_BODY(fun));
+    if (
+        NOT(GET_SER_INFO(body, ARRAY_INFO_BYTECODE))
+        || PG_Do != &Do_Core // e.g. TRACE was turned on by the caller
+        || PG_Apply != &Apply_Core
+    ){
+        return NULL;
+    }
+
+    REBVAL *param = FUNC_FACADE_HEAD(fun);
+    for (; NOT_END(param); ++param) {
+        switch (VAL_PARAM_CLASS(param)) {
+        case PARAM_CLASS_LOCAL:
+        case PARAM_CLASS_RETURN:
+        case PARAM_CLASS_LEAVE:
+            break;
+
+        case PARAM_CLASS_NORMAL:
+            if (
+                GET_VAL_FLAG(param, TYPESET_FLAG_HIDDEN)
+                || GET_VAL_FLAG(param, TYPESET_FLAG_VARIADIC)
+            ){
+                return NULL;
+            }
+            break;
+
+        default:
+            return NULL; // refinements, quoted...
+        }
+    }
+
+    struct Reb_Bytecode *code = Find_Bytecode(body);
+    return code->insns == NULL ? NULL : code;
+}
+
+
+// What Do_Core() does with the arguments Fill_Args() put in a frame for a
+// function that Trampoline_Code() allows: type check them, void the locals
+// and fill in RETURN and LEAVE.
+//
+static void Check_Args(REBFRM *f)
+{
+    REBVAL *param = FUNC_FACADE_HEAD(f->phase);
+    REBVAL *arg = f->args_head;
+    for (; NOT_END(param); ++param, ++arg) {
+        switch (VAL_PARAM_CLASS(param)) {
+        case PARAM_CLASS_LOCAL:
+            Init_Void(arg);
+            break;
+
+        case PARAM_CLASS_RETURN:
+            if (GET_FUN_FLAG(f->phase, FUNC_FLAG_RETURN)) {
+                Move_Value(arg, NAT_VALUE(return));
+                INIT_BINDING(arg, f);
+            }
+            else
+                Init_Void(arg);
+            break;
+
+        case PARAM_CLASS_LEAVE:
+            if (GET_FUN_FLAG(f->phase, FUNC_FLAG_LEAVE)) {
+                Move_Value(arg, NAT_VALUE(leave));
+                INIT_BINDING(arg, f);
+            }
+            else
+                Init_Void(arg);
+            break;
+
+        default:
+            assert(VAL_PARAM_CLASS(param) == PARAM_CLASS_NORMAL);
+            if (NOT(TYPE_CHECK(param, VAL_TYPE(arg))))
+                fail (Error_Arg_Type(f, param, VAL_TYPE(arg)));
+        }
+    }
+
+    f->param = END; // arguments are fulfilled, see Is_Function_Frame_Fulfilling
+    f->special = NULL;
+    f->deferred = NULL;
+    f->dsp_orig = DSP;
+}
+
+
+// What the dispatcher of a function that Trampoline_Code() allows and then
+// Do_Core() do after its body has given its result in f->out.
+//
+static void Finish_Call(REBFRM *f)
+{
+    REBNAT dispatcher = FUNC_DISPATCHER(f->phase);
+    if (dispatcher == &Voider_Dispatcher)
+        Init_Void(f->out);
+    else {
+        if (dispatcher == &Returner_Dispatcher) {
+            REBVAL *typeset = FUNC_PARAM(f->phase, FUNC_NUM_PARAMS(f->phase));
+            if (NOT(TYPE_CHECK(typeset, VAL_TYPE(f->out))))
+                fail (Error_Bad_Return_Type(f, VAL_TYPE(f->out)));
+        }
+        CLEAR_VAL_FLAG(f->out, VALUE_FLAG_UNEVALUATED);
+    }
+
+    const REBOOL drop_chunks = TRUE;
+    Drop_Function_Core(f, drop_chunks);
+}
+
+
+static struct Reb_Continuation *Push_Continuation(void)
+{
+    struct Reb_Continuation *cont = (TG_Continuation == NULL)
+        ? Continuations
+        : TG_Continuation->next;
+
+    if (cont == NULL) {
+        cont = ALLOC(struct Reb_Continuation);
+        if (cont == NULL)
+            fail (Error_No_Memory(sizeof(struct Reb_Continuation)));
+        cont->next = NULL;
+        if (TG_Continuation == NULL)
+            Continuations = cont;
+        else
+            TG_Continuation->next = cont;
+    }
+
+    cont->prior = TG_Continuation;
+    TG_Continuation = cont;
+
+    Prep_Stack_Cell(&cont->frame.cell); // as DECLARE_FRAME() would
+    Init_Unreadable_Blank(&cont->frame.cell);
+    return cont;
+}
+
+
+// Whether the value at `index` is a word for an enfix function, which would
+// take the result of what came before it (see `continue_enfix:` below).
+//
+static REBOOL Continues_Enfix(REBFRM *f, REBARR *array, REBCNT index)
+{
+    const RELVAL *v = ARR_AT(array, index);
+    if (NOT(IS_WORD(v)))
+        return FALSE;
+
+    const REBVAL *var = Get_Opt_Var_Else_End(v, AS_SPECIFIER(f));
+    return LOGICAL(
+        NOT_END(var)
+        && IS_FUNCTION(var)
+        && GET_VAL_FLAG(var, VALUE_FLAG_ENFIXED)
+    );
+}
+
+
+// Calls to other compiled bodies are run here too, in continuations pushed
+// above `cont_base` (see Trampoline_Code()).  `f` and `code` are switched to
+// the call's for the duration, and switched back when it finishes.
+//
+static REBOOL Run_Bytecode_Throws(REBFRM *f, struct Reb_Bytecode *code)
+{
+    struct Reb_Continuation * const cont_base = TG_Continuation;
+    struct Reb_Continuation *cont;
+    struct Reb_Bytecode *callee;
+
+    REBDSP base;
+    REBCNT n;
+    struct Reb_Insn *insns;
+    struct Reb_Insn *i;
+    struct Reb_Guard *g;
+    struct Reb_Guard *g_tail;
+    const REBVAL *var;
+    REBVAL *reg;
+    REBVAL *argv[MAX_CALL_ARGS + 1];
+    REBIXO indexor;
+    REBOOL invisible;
+    REBOOL stop;
+    REBI64 count;
+
+    REBCNT pc;
+    REBCNT stmt = 0; // STMT or FALLBACK of the statement running
+    REBCNT index = 0; // where to DO/NEXT from in the statement's array
+
+    struct Reb_Bytecode_Run run;
+    run.base = run.f = f;
+    run.code = code;
+    run.pc = NOT_FOUND;
+    run.cont_base = cont_base;
+    run.prior = TG_Bytecode_Run;
+    TG_Bytecode_Run = &run;
+
+enter_code:
+    base = DSP;
+    for (n = 0; n < code->num_regs; ++n) {
+        DS_PUSH_TRASH;
+        Init_Void(DS_TOP);
+    }
+    insns = code->insns;
+    pc = 0;
+
+    while (TRUE) {
+        i = &insns[pc];
+        run.pc = pc;
+
+        switch (i->op) {
+        case BC_STMT:
+            assert(Eval_Count >= 0);
+            if (--Eval_Count == 0 && Do_Signals_Throws(f->out))
+                goto thrown;
+
+            stmt = pc;
+            g = code->guards + i->a;
+            g_tail = g + i->d;
+            for (; g != g_tail; ++g) {
+                if (NOT(Guard_Holds(f, g))) {
+                    index = i->index;
+                    goto fallback;
+                }
+            }
+            ++pc;
+            continue;
+
+        case BC_FALLBACK:
+            stmt = pc;
+            index = i->index;
+            goto fallback;
+
+        case BC_CHECK:
+            g = code->guards + i->a;
+            g_tail = g + i->d;
+            for (; g != g_tail; ++g) {
+                if (NOT(Guard_Holds(f, g)))
+                    goto resume;
+            }
+            ++pc;
+            continue;
+
+        case BC_FETCH:
+            //
+            // A function in a variable of the frame, e.g. its definitional
+            // RETURN, may be bound to the frame before it's reified.  The
+            // register won't outlive the frame, so unlike Move_Value() this
+            // doesn't reify it (which would stop tail calls).
+            //
+            var = Var_At(f, i->slot, i->array, i->index);
+            reg = REG(i->dest);
+            Move_Value_Header(reg, var);
+            reg->payload = var->payload;
+            reg->extra = var->extra;
+            ++pc;
+            continue;
+
+        case BC_LITERAL:
+            reg = REG(i->dest);
+            Derelativize(reg, ARR_AT(i->array, i->index), AS_SPECIFIER(f));
+            SET_VAL_FLAG(reg, VALUE_FLAG_UNEVALUATED);
+            ++pc;
+            continue;
+
+        case BC_GET:
+            var = Var_At(f, i->slot, i->array, i->index);
+            assert(NOT_END(var) && NOT(IS_FUNCTION(var))); // see guards
+            if (IS_VOID(var))
+                fail (Error_No_Value_Core(
+                    ARR_AT(i->array, i->index), AS_SPECIFIER(f)
+                ));
+            Move_Value(REG(i->dest), var);
+            ++pc;
+            continue;
+
+        case BC_GET_OPT:
+            if (i->slot != 0)
+                Move_Value(REG(i->dest), FRM_ARG(f, i->slot));
+            else
+                Copy_Opt_Var_May_Fail(
+                    REG(i->dest), ARR_AT(i->array, i->index), AS_SPECIFIER(f)
+                );
+            ++pc;
+            continue;
+
+        case BC_LIT_WORD:
+            reg = REG(i->dest);
+            Derelativize(reg, ARR_AT(i->array, i->index), AS_SPECIFIER(f));
+            VAL_SET_TYPE_BITS(reg, REB_WORD);
+            ++pc;
+            continue;
+
+        case BC_SET: {
+            REBVAL *sink;
+            if (
+                i->slot != 0
+                && NOT(f->flags.bits & DO_FLAG_NATIVE_HOLD)
+                && NOT_VAL_FLAG(FRM_ARG(f, i->slot), CELL_FLAG_PROTECTED)
+            ){
+                sink = FRM_ARG(f, i->slot);
+            }
+            else
+                sink = Sink_Var_May_Fail(
+                    ARR_AT(i->array, i->index), AS_SPECIFIER(f)
+                );
+            Move_Value(sink, REG(i->a));
+            ++pc;
+            continue; }
+
+        case BC_TAIL_CALL:
+            var = INSN_FUN(f, i);
+            for (n = 0; n < i->b; ++n)
+                argv[n] = REG(i->a + n);
+            if (Try_Tail_Call(
+                f,
+                base,
+                var,
+                VAL_WORD_SPELLING(ARR_AT(i->array, i->index)),
+                argv,
+                i->c != 0 ? INSN_FUN(f, &insns[pc + 1]) : NULL // `return`
+            )){
+                DS_DROP_TO(base);
+                if (TG_Continuation != cont_base)
+                    goto enter_frame;
+                SET_END(f->out); // tells dispatcher to redo, see Do_Body_Throws
+                TG_Bytecode_Run = run.prior;
+                return FALSE;
+            }
+            // falls through
+
+        case BC_CALL:
+            var = INSN_FUN(f, i);
+            for (n = 0; n < i->b; ++n)
+                argv[n] = REG(i->a + n);
+
+            callee = Trampoline_Code(VAL_FUNC(var));
+            if (callee != NULL) {
+                cont = Push_Continuation();
+                cont->code = code;
+                cont->pc = pc;
+                cont->base = base;
+                Push_Call_Frame(
+                    &cont->frame,
+                    f->out,
+                    var,
+                    VAL_WORD_SPELLING(ARR_AT(i->array, i->index)),
+                    argv
+                );
+                f = &cont->frame;
+                code = callee;
+                goto check_frame;
+            }
+
+            if (Apply_Args_Throws(
+                f->out,
+                var,
+                VAL_WORD_SPELLING(ARR_AT(i->array, i->index)),
+                argv
+            )){
+                goto thrown;
+            }
+            Move_Keep_Unevaluated(REG(i->dest), f->out);
+            ++pc;
+            continue;
+
+        case BC_ENFIX:
+            var = INSN_FUN(f, i);
+            if (Quick_Binary_Op(
+                REG(i->dest), VAL_FUNC(var), REG(i->a), REG(i->b)
+            )){
+                ++pc;
+                continue;
+            }
+
+            if (i->d != NOT_FOUND) {
+                //
+                // Words after the operator were compiled on the condition
+                // that it didn't run code, so evaluate from the check the
+                // statement last passed instead (see Note_Op()).
+                //
+                pc = i->d;
+                i = &insns[pc];
+                if (i->op == BC_CHECK)
+                    goto resume;
+                stmt = pc;
+                index = i->index;
+                goto fallback;
+            }
+
+            CLEAR_VAL_FLAG(REG(i->a), VALUE_FLAG_UNEVALUATED); // evaluated
+            argv[0] = REG(i->a);
+            argv[1] = REG(i->b);
+            if (Apply_Args_Throws(
+                f->out,
+                var,
+                VAL_WORD_SPELLING(ARR_AT(i->array, i->index)),
+                argv
+            )){
+                goto thrown;
+            }
+            Move_Keep_Unevaluated(REG(i->dest), f->out);
+            ++pc;
+            continue;
+
+        case BC_VOID:
+            Init_Void(REG(i->dest));
+            ++pc;
+            continue;
+
+        case BC_BLANKIFY:
+            reg = REG(i->dest);
+            if (IS_VOID(reg))
+                Init_Blank(reg);
+            else
+                CLEAR_VAL_FLAG(reg, VALUE_FLAG_UNEVALUATED);
+            ++pc;
+            continue;
+
+        case BC_TRUTHIFY:
+            reg = REG(i->dest);
+            if (IS_VOID(reg) || IS_FALSEY(reg))
+                Init_Bar(reg);
+            else
+                CLEAR_VAL_FLAG(reg, VALUE_FLAG_UNEVALUATED);
+            ++pc;
+            continue;
+
+        case BC_JUMP:
+            pc = i->c;
+            continue;
+
+        case BC_IF_FALSE:
+            if (IS_VOID(REG(i->a)))
+                goto call_native; // let the native give the error
+
+            if (IS_CONDITIONAL_FALSE(REG(i->a), FALSE)) // /ONLY not compiled
+                pc = i->b;
+            else
+                ++pc;
+            continue;
+
+        case BC_LOOP_START:
+            reg = REG(i->a);
+            if (IS_VOID(reg))
+                goto call_native;
+
+            if (IS_FALSEY(reg)) {
+                Init_Void(REG(i->dest));
+                pc = i->c;
+                continue;
+            }
+
+            if (IS_LOGIC(reg))
+                count = MAX_I64; // LOOP TRUE, LOOP_NEXT doesn't count down
+            else if (ANY_NUMBER(reg))
+                count = Int64(reg);
+            else
+                goto call_native;
+
+            if (count <= 0) {
+                Init_Void(REG(i->dest));
+                pc = i->c;
+                continue;
+            }
+            Init_Integer(REG(i->b), count);
+            ++pc;
+            continue;
+
+        case BC_LOOP_NEXT:
+            if (NOT(IS_LOGIC(REG(i->a)))) {
+                count = VAL_INT64(REG(i->b)) - 1;
+                if (count == 0) {
+                    ++pc;
+                    continue;
+                }
+                Init_Integer(REG(i->b), count);
+            }
+            pc = i->c;
+            continue;
+
+        case BC_WHILE_START:
+            Init_Void(REG(i->dest));
+            Init_Logic(REG(i->b), FALSE);
+            ++pc;
+            continue;
+
+        case BC_WHILE_TEST:
+            reg = REG(i->a);
+            if (IS_VOID(reg) || IS_FALSEY(reg))
+                pc = i->c;
+            else
+                ++pc;
+            continue;
+
+        case BC_WHILE_NEXT:
+            Init_Logic(REG(i->b), TRUE);
+            pc = i->c;
+            continue;
+
+        case BC_WHILE_FINISH:
+            reg = REG(i->dest);
+            if (NOT(VAL_LOGIC(REG(i->b))))
+                Init_Void(reg); // body never ran
+            else if (IS_VOID(reg) || IS_FALSEY(reg))
+                Init_Bar(reg);
+            else
+                CLEAR_VAL_FLAG(reg, VALUE_FLAG_UNEVALUATED);
+            ++pc;
+            continue;
+
+        case BC_END:
+            Move_Keep_Unevaluated(f->out, REG(0));
+            DS_DROP_TO(base);
+            if (TG_Continuation == cont_base) {
+                TG_Bytecode_Run = run.prior;
+                return FALSE;
+            }
+
+            Finish_Call(f);
+            Drop_Frame_Core(f);
+            goto exit_frame;
+
+        default:
+            assert(FALSE);
+        }
+
+    call_native:
+        //
+        // A control word got an argument it doesn't compile for.  Rather
+        // than copy the error reporting, call the native, with the literal
+        // blocks following its first argument.
+        //
+        for (n = 0; n <= (i->op == BC_IF_FALSE ? i->c : 1); ++n) {
+            if (n != 0)
+                Derelativize(
+                    REG(i->a + n),
+                    ARR_AT(i->array, i->block + n - 1),
+                    AS_SPECIFIER(f)
+                );
+            argv[n] = REG(i->a + n);
+        }
+        if (Apply_Args_Throws(
+            f->out,
+            FUNC_VALUE(i->fun),
+            VAL_WORD_SPELLING(ARR_AT(i->array, i->index)),
+            argv
+        )){
+            goto thrown;
+        }
+        Move_Keep_Unevaluated(REG(i->dest), f->out);
+        pc = (i->op == BC_IF_FALSE) ? i->d : i->c;
+        continue;
+
+    fallback:
+        //
+        // If the statement before made the word this one starts with enfix,
+        // the evaluator would have continued that statement with it.
+        //
+        i = &insns[stmt];
+        if (
+            NOT(IS_VOID(REG(i->dest)))
+            && Continues_Enfix(f, i->array, index)
+        ){
+            goto continue_enfix;
+        }
+
+    fallback_next:
+        //
+        // Run the statement's array from `index` with DO/NEXT until a
+        // compiled statement (or the end of the array) is reached.
+        //
+        i = &insns[stmt];
+
+        invisible = FALSE;
+        if (IS_WORD(ARR_AT(i->array, index))) {
+            var = Get_Opt_Var_Else_End(
+                ARR_AT(i->array, index), AS_SPECIFIER(f)
+            );
+            invisible = LOGICAL(
+                NOT_END(var)
+                && IS_FUNCTION(var)
+                && GET_VAL_FLAG(var, FUNC_FLAG_INVISIBLE)
+            );
+        }
+
+        indexor = DO_NEXT_MAY_THROW(f->out, i->array, index, AS_SPECIFIER(f));
+        if (indexor == THROWN_FLAG) {
+            pc = stmt;
+            goto thrown;
+        }
+
+        if (
+            NOT(invisible)
+            || NOT(IS_VOID(f->out))
+            || NOT_VAL_FLAG(f->out, VALUE_FLAG_UNEVALUATED)
+        ){
+            Move_Keep_Unevaluated(REG(i->dest), f->out);
+        }
+
+    fallback_stepped:
+        if (indexor == END_FLAG) {
+            pc = i->c;
+            continue;
+        }
+        index = indexor;
+
+        if (
+            NOT(IS_VOID(REG(i->dest)))
+            && Continues_Enfix(f, i->array, index)
+        ){
+            goto continue_enfix;
+        }
+
+        pc = i->b;
+        while (pc != i->c && insns[pc].index < index)
+            pc = insns[pc].b;
+        if (pc != i->c && insns[pc].index == index)
+            continue; // enter the statement, or fall back again from it
+        goto fallback_next;
+
+    continue_enfix: {
+        //
+        // A DO/NEXT stopping in front of an enfix function is also how what
+        // came before it being invisible shows (e.g. `1 comment "a" + 2`).
+        // Evaluating to the end of the list would have let the operator take
+        // the previous result, so do that, with it fed in as an inert value.
+        //
+        DECLARE_LOCAL (left);
+        Move_Value(left, REG(i->dest)); // register keeps it GC safe
+        SET_VAL_FLAG(left, VALUE_FLAG_EVAL_FLIP); // take as inert
+
+        if (THROWN_FLAG == Do_Array_At_Core(
+            f->out,
+            left,
+            i->array,
+            index,
+            AS_SPECIFIER(f),
+            DO_FLAG_TO_END
+        )){
+            pc = stmt;
+            goto thrown;
+        }
+        Move_Keep_Unevaluated(REG(i->dest), f->out);
+        pc = i->c;
+        continue; }
+
+    resume: {
+        //
+        // The rest of the statement from the operator at BC_CHECK `i` isn't
+        // what was compiled, due to code run by what came before it.  Have
+        // the evaluator continue the expression from the operator, with what
+        // came before as its left hand side, and set any SET-WORD!s of the
+        // statement to the result (the last one first, as Do_Core() does).
+        //
+        DECLARE_LOCAL (left);
+        Move_Value(left, REG(i->dest));
+        SET_VAL_FLAG(left, VALUE_FLAG_EVAL_FLIP); // take as inert
+
+        stmt = i->b;
+        indexor = Do_Array_At_Core(
+            f->out,
+            left,
+            i->array,
+            i->index,
+            AS_SPECIFIER(f),
+            DO_FLAG_NORMAL
+        );
+        if (indexor == THROWN_FLAG) {
+            pc = stmt;
+            goto thrown;
+        }
+
+        i = &insns[stmt];
+        Move_Keep_Unevaluated(REG(i->dest), f->out);
+
+        for (n = i->index; IS_SET_WORD(ARR_AT(i->array, n)); ++n)
+            NOOP;
+        while (n != i->index) {
+            --n;
+            Move_Value(
+                Sink_Var_May_Fail(ARR_AT(i->array, n), AS_SPECIFIER(f)),
+                REG(i->dest)
+            );
+        }
+        goto fallback_stepped; }
+
+    thrown:
+        if (
+            insns[pc].loop != NOT_FOUND
+            && Catching_Break_Or_Continue(f->out, &stop)
+        ){
+            i = &insns[insns[pc].loop];
+            if (stop) {
+                Init_Blank(REG(i->dest));
+                pc = i->c;
+            }
+            else {
+                Move_Keep_Unevaluated(REG(i->dest), f->out);
+                pc = i->d;
+            }
+            continue;
+        }
+
+        DS_DROP_TO(base);
+        if (TG_Continuation == cont_base) {
+            TG_Bytecode_Run = run.prior;
+            return TRUE;
+        }
+
+        // A throw out of a call in a continuation is handled the way that
+        // Do_Core() handles R_OUT_IS_THROWN for the call.
+        //
+        if (IS_FUNCTION(f->out) && Same_Binding(VAL_BINDING(f->out), f)) {
+            if (VAL_FUNC(f->out) == NAT_FUNC(exit)) {
+                CATCH_THROWN(f->out, f->out);
+                Drop_Function_Core(f, TRUE);
+                Drop_Frame_Core(f);
+                goto exit_frame;
+            }
+
+            if (VAL_FUNC(f->out) == NAT_FUNC(redo)) {
+                CATCH_THROWN(f->out, f->out);
+                assert(IS_FRAME(f->out));
+
+                REBFUN *phase = f->out->payload.any_context.phase;
+                REBCTX *exemplar;
+                if (
+                    f->phase != phase
+                    && NULL != (exemplar = FUNC_EXEMPLAR(phase))
+                ){
+                    REBVAL *special = CTX_VARS_HEAD(exemplar);
+                    REBVAL *arg = f->args_head;
+                    for (; NOT_END(arg); ++arg, ++special) {
+                        if (NOT(IS_VOID(special)))
+                            Move_Value(arg, special);
+                    }
+                }
+
+                f->phase = phase;
+                f->binding = VAL_BINDING(f->out);
+                goto enter_frame;
+            }
+        }
+
+        Drop_Function_Core(f, TRUE);
+        Drop_Frame_Core(f);
+        goto exit_frame;
+
+    enter_frame:
+        //
+        // The function and arguments of frame `f` in the top continuation
+        // were changed, by a tail call or REDO.  If the body can't be run
+        // here, run the call with Do_Core() as Apply_Args_Throws() would.
+        //
+        run.pc = NOT_FOUND;
+        code = Trampoline_Code(f->phase);
+        if (code == NULL) {
+            f->special = f->args_head;
+            f->refine = NULL;
+            (*PG_Do)(f);
+            Drop_Frame_Core(f);
+            goto exit_frame;
+        }
+
+    check_frame:
+        run.f = f;
+        run.code = code;
+        run.pc = NOT_FOUND; // at the caller's call until the body is entered
+        Check_Args(f);
+        goto enter_code;
+
+    exit_frame:
+        //
+        // The call in the top continuation is finished and its frame was
+        // dropped, so go back to the caller's instruction with the result.
+        //
+        cont = TG_Continuation;
+        TG_Continuation = cont->prior;
+
+        f = FS_TOP;
+        code = cont->code;
+        insns = code->insns;
+        base = cont->base;
+        pc = cont->pc;
+        run.f = f;
+        run.code = code;
+
+        if (THROWN(f->out))
+            goto thrown;
+
+        Move_Keep_Unevaluated(REG(insns[pc].dest), f->out);
+        ++pc;
+    }
+}
+
+
+//=//// COMPILING /////////////////////////////////////////////////////////=//
+
+// The instructions from a BC_STMT or BC_CHECK to the next one of the same
+// statement (or its end), whose guards that BC_STMT or BC_CHECK checks.
+//
+struct Reb_Segment {
+    REBCNT check; // the BC_STMT or BC_CHECK
+    REBCNT stmt; // the BC_STMT of the statement
+    REBCNT guards; // first of the compiler's `pending` checked by `check`
+    REBCNT ops; // first of the compiler's `ops` in the segment
+    REBOOL ran_code; // a call (or such) was compiled since `check`
+    REBOOL stmt_ran_code; // a call (or such) was compiled since `stmt`
+    REBCNT look_index; // of the latest word looked up
+    REBOOL look_ran_code; // `ran_code` when it was looked up
+    REBCNT look_ops; // `num_ops` when it was looked up
+    REBOOL prior_ran_code; // `ran_code` for the latest one before that index
+    REBCNT prior_ops; // `num_ops` for the latest one before that index
+};
+
+struct Reb_Compiler {
+    REBFRM *f; // the call that made the body hot, for looking up words
+    REBARR *body;
+
+    struct Reb_Insn *insns;
+    REBCNT num_insns;
+    REBCNT max_insns;
+
+    struct Reb_Guard *guards; // of finished statements
+    REBCNT num_guards;
+    REBCNT max_guards;
+
+    struct Reb_Guard *pending; // of statements being compiled
+    REBCNT num_pending;
+    REBCNT max_pending;
+
+    REBCNT *ops; // BC_ENFIX which don't run code if Quick_Binary_Op() works
+    REBCNT num_ops;
+    REBCNT max_ops;
+
+    struct Reb_Segment seg; // of the statement being compiled
+    REBOOL in_group; // statements being compiled are in a GROUP!
+
+    REBCNT next_reg;
+    REBCNT num_regs;
+
+    REBCNT loop; // instruction of innermost loop being compiled
+    REBCNT ctl; // instruction of innermost IF, EITHER, LOOP or WHILE
+    REBCNT num_compiled; // statements that aren't BC_FALLBACK
+};
+
+
+static void *Grow_Buffer(void *data, REBCNT len, REBCNT *max, size_t wide)
+{
+    REBCNT new_max = (*max == 0) ? 16 : *max * 2;
+    void *new_data = Alloc_Mem(new_max * wide);
+    if (data != NULL) {
+        memcpy(new_data, data, len * wide);
+        Free_Mem(data, *max * wide);
+    }
+    *max = new_max;
+    return new_data;
+}
+
+
+static REBCNT Emit_Insn(
+    struct Reb_Compiler *c,
+    REBCNT op,
+    REBCNT dest,
+    REBARR *array,
+    REBCNT index
+){
+    if (c->num_insns == c->max_insns)
+        c->insns = cast(struct Reb_Insn*, Grow_Buffer(
+            c->insns, c->num_insns, &c->max_insns, sizeof(struct Reb_Insn)
+        ));
+
+    struct Reb_Insn *i = &c->insns[c->num_insns];
+    i->op = op;
+    i->dest = dest;
+    i->a = i->b = i->c = i->d = 0;
+    i->loop = c->loop;
+    i->slot = 0;
+    i->array = array;
+    i->index = index;
+    i->end = index + 1;
+    i->ctl = c->ctl;
+    i->block = 0;
+    i->fn = NOT_FOUND;
+    i->fun = NULL;
+    return c->num_insns++;
+}
+
+
+static void Add_Guard(
+    struct Reb_Compiler *c,
+    REBCNT kind,
+    REBCNT arg,
+    REBARR *array,
+    REBCNT index,
+    REBCNT slot,
+    REBFUN *fun
+){
+    if (c->num_pending != 0) {
+        //
+        // A word is peeked at to see it isn't an enfix operator continuing
+        // an expression before it is compiled as the next term or call, and
+        // the guard for that covers the check.
+        //
+        struct Reb_Guard *last = &c->pending[c->num_pending - 1];
+        if (
+            last->kind == GUARD_NOT_ENFIX
+            && last->array == array
+            && last->index == index
+        ){
+            --c->num_pending;
+        }
+    }
+
+    if (c->num_pending == c->max_pending)
+        c->pending = cast(struct Reb_Guard*, Grow_Buffer(
+            c->pending, c->num_pending, &c->max_pending,
+            sizeof(struct Reb_Guard)
+        ));
+
+    struct Reb_Guard *g = &c->pending[c->num_pending++];
+    g->kind = kind;
+    g->arg = arg;
+    g->slot = slot;
+    g->array = array;
+    g->index = index;
+    g->fun = fun;
+    g->epoch = GC_Epoch;
+}
+
+
+static REBCNT Alloc_Regs(struct Reb_Compiler *c, REBCNT n)
+{
+    REBCNT reg = c->next_reg;
+    c->next_reg += n;
+    if (c->next_reg > c->num_regs)
+        c->num_regs = c->next_reg;
+    return reg;
+}
+
+
+// Move the guards pending from `from` to the guards of BC_STMT or BC_CHECK
+// instruction `pc`.
+//
+static void Flush_Guards(struct Reb_Compiler *c, REBCNT from, REBCNT pc)
+{
+    REBCNT n = c->num_pending - from;
+    while (c->num_guards + n > c->max_guards)
+        c->guards = cast(struct Reb_Guard*, Grow_Buffer(
+            c->guards, c->num_guards, &c->max_guards,
+            sizeof(struct Reb_Guard)
+        ));
+    memcpy(
+        c->guards + c->num_guards,
+        c->pending + from,
+        n * sizeof(struct Reb_Guard)
+    );
+    c->insns[pc].a = c->num_guards;
+    c->insns[pc].d = n;
+    c->num_guards += n;
+    c->num_pending = from;
+}
+
+
+static void Start_Segment(struct Reb_Compiler *c, REBCNT check)
+{
+    struct Reb_Segment *seg = &c->seg;
+    seg->check = check;
+    seg->guards = c->num_pending;
+    seg->ops = c->num_ops;
+    seg->ran_code = FALSE;
+    seg->look_index = NOT_FOUND;
+    seg->look_ran_code = seg->prior_ran_code = FALSE;
+    seg->look_ops = seg->prior_ops = c->num_ops;
+}
+
+
+// A word at `index` of the statement is looked up, as the evaluator would
+// when it got to it.  See End_Segment() for what that requires.
+//
+static void Note_Lookup(struct Reb_Compiler *c, REBCNT index)
+{
+    struct Reb_Segment *seg = &c->seg;
+    if (index != seg->look_index) {
+        seg->prior_ran_code = seg->look_ran_code;
+        seg->prior_ops = seg->look_ops;
+        seg->look_index = index;
+    }
+    seg->look_ran_code = seg->ran_code;
+    seg->look_ops = c->num_ops;
+}
+
+
+// Something which may run code, and so change what words look up to, was
+// compiled: a call, a SET-WORD!, a control word with its branches...
+//
+static void Note_Ran_Code(struct Reb_Compiler *c)
+{
+    c->seg.ran_code = TRUE;
+    c->seg.stmt_ran_code = TRUE;
+}
+
+
+// Whether `fun` is one of the operators Quick_Binary_Op() may do, which
+// don't run code unless they have to be called in full.
+//
+static REBOOL Is_Quick_Op(REBFUN *fun)
+{
+    if (FUNC_FACADE_NUM_RELEASE_PARAMS(fun) != 2 || FUNC_EXEMPLAR(fun) != NULL)
+        return FALSE;
+
+    REBNAT dispatcher = FUNC_DISPATCHER(fun);
+    if (dispatcher == &Action_Dispatcher) {
+        REBSYM sym = VAL_WORD_SYM(FUNC_BODY(fun));
+        return LOGICAL(
+            sym == SYM_ADD || sym == SYM_SUBTRACT || sym == SYM_MULTIPLY
+        );
+    }
+    return LOGICAL(
+        dispatcher == &N_equal_q
+        || dispatcher == &N_not_equal_q
+        || dispatcher == &N_lesser_q
+        || dispatcher == &N_lesser_or_equal_q
+        || dispatcher == &N_greater_q
+        || dispatcher == &N_greater_or_equal_q
+    );
+}
+
+
+// BC_ENFIX `pc` for `fun` was compiled.  If `fun` is a quick operator, it's
+// not counted as running code, which End_Segment() may rely on.  Then if
+// Quick_Binary_Op() can't do it, the statement is evaluated from the check
+// in `d` instead.
+//
+static void Note_Op(struct Reb_Compiler *c, REBCNT pc, REBFUN *fun)
+{
+    c->insns[pc].d = NOT_FOUND;
+
+    if (NOT(Is_Quick_Op(fun))) {
+        Note_Ran_Code(c);
+        return;
+    }
+
+    if (c->num_ops == c->max_ops)
+        c->ops = cast(REBCNT*, Grow_Buffer(
+            c->ops, c->num_ops, &c->max_ops, sizeof(REBCNT)
+        ));
+    c->ops[c->num_ops++] = pc;
+}
+
+
+// The segment being compiled ends at `index`: the end of the statement, or
+// the operator of a BC_CHECK.  (The word there is looked up again before it
+// is used, by the BC_CHECK or by the fallback of the next statement.)
+//
+// Words looked up before `index` must be what the guards of the segment saw
+// them to be, so no code can run before them.  A call before one means the
+// statement isn't compiled, and a quick operator before one must fall back
+// on the check instead of calling the operator in full.
+//
+static REBOOL End_Segment(struct Reb_Compiler *c, REBCNT index)
+{
+    struct Reb_Segment *seg = &c->seg;
+
+    REBOOL ran_code;
+    REBCNT ops;
+    if (seg->look_index == index) {
+        ran_code = seg->prior_ran_code;
+        ops = seg->prior_ops;
+    }
+    else {
+        ran_code = seg->look_ran_code;
+        ops = seg->look_ops;
+    }
+
+    if (ran_code)
+        return FALSE;
+
+    REBCNT n;
+    for (n = seg->ops; n < ops; ++n)
+        c->insns[c->ops[n]].d = seg->check;
+    return TRUE;
+}
+
+
+// Before an operator continuing the expression of a statement that may have
+// run code, start a segment with a BC_CHECK of the guards from there on.
+//
+static REBOOL Check_Before_Op(
+    struct Reb_Compiler *c,
+    REBARR *array,
+    REBCNT index,
+    REBCNT dest
+){
+    if (NOT(c->seg.stmt_ran_code))
+        return TRUE;
+
+    if (NOT(End_Segment(c, index)))
+        return FALSE;
+    Flush_Guards(c, c->seg.guards, c->seg.check);
+
+    REBCNT pc = Emit_Insn(c, BC_CHECK, dest, array, index);
+    c->insns[pc].b = c->seg.stmt;
+    Start_Segment(c, pc);
+    return TRUE;
+}
+
+
+// Get the function at `index` into a register before its arguments run code,
+// which might change what its word looks up to.
+//
+static REBCNT Fetch_Fun(
+    struct Reb_Compiler *c,
+    REBARR *array,
+    REBCNT index,
+    REBCNT slot
+){
+    REBCNT fn = Alloc_Regs(c, 1);
+    REBCNT pc = Emit_Insn(c, BC_FETCH, fn, array, index);
+    c->insns[pc].slot = slot;
+    return fn;
+}
+
+
+// What an ANY-WORD! in the body looks up to in the call being compiled for,
+// or END if it doesn't look up to anything.  A relative word's frame index
+// is put in `slot`, else it is 0.
+//
+static const REBVAL *Peek_Var(
+    struct Reb_Compiler *c,
+    const RELVAL *any_word,
+    REBCNT *slot
+){
+    *slot = 0;
+
+    if (GET_VAL_FLAG(any_word, VALUE_FLAG_EVAL_FLIP))
+        return END; // not compiled
+
+    if (IS_RELATIVE(any_word)) {
+        if (NOT(Same_Binding(VAL_BINDING(any_word), FRM_UNDERLYING(c->f))))
+            return END;
+        *slot = VAL_WORD_INDEX(any_word);
+        return FRM_ARG(c->f, *slot);
+    }
+
+    return Get_Opt_Var_Else_End(any_word, SPECIFIED);
+}
+
+
+// Arity of the function a WORD! calls, or NOT_FOUND if it isn't a WORD! for
+// a call that can be compiled.
+//
+static REBCNT Call_Word_Arity(struct Reb_Compiler *c, const RELVAL *v)
+{
+    if (IS_END(v) || NOT(IS_WORD(v)))
+        return NOT_FOUND;
+
+    REBCNT slot;
+    const REBVAL *var = Peek_Var(c, v, &slot);
+    if (
+        IS_END(var)
+        || NOT(IS_FUNCTION(var))
+        || GET_VAL_FLAG(var, VALUE_FLAG_ENFIXED)
+    ){
+        return NOT_FOUND;
+    }
+    return Call_Arity(VAL_FUNC(var));
+}
+
+
+static REBOOL Is_Enfix_Word(struct Reb_Compiler *c, const RELVAL *v)
+{
+    if (IS_END(v) || NOT(IS_WORD(v)))
+        return FALSE;
+
+    REBCNT slot;
+    const REBVAL *var = Peek_Var(c, v, &slot);
+    return LOGICAL(
+        NOT_END(var)
+        && IS_FUNCTION(var)
+        && GET_VAL_FLAG(var, VALUE_FLAG_ENFIXED)
+    );
+}
+
+
+// Whether the `n` values from `index` are terms that can't run any code, so
+// a function taking them as arguments can be looked up after they are.
+//
+static REBOOL Inert_Terms(
+    struct Reb_Compiler *c,
+    REBARR *array,
+    REBCNT index,
+    REBCNT n
+){
+    for (; n != 0; --n, ++index) {
+        const RELVAL *v = ARR_AT(array, index);
+        if (IS_END(v) || IS_GROUP(v))
+            return FALSE;
+
+        if (IS_WORD(v)) {
+            REBCNT slot;
+            const REBVAL *var = Peek_Var(c, v, &slot);
+            if (IS_END(var) || IS_FUNCTION(var))
+                return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+
+// See if the value at `index` continues an expression as an enfix operator.
+// If it's a word that doesn't, then a guard is added that it stays that way.
+//
+static REBCNT Peek_Op(struct Reb_Compiler *c, REBARR *array, REBCNT index)
+{
+    const RELVAL *v = ARR_AT(array, index);
+    if (IS_END(v) || NOT(IS_WORD(v)))
+        return OP_KIND_NONE;
+
+    Note_Lookup(c, index);
+
+    REBCNT slot;
+    const REBVAL *var = Peek_Var(c, v, &slot);
+    if (GET_VAL_FLAG(v, VALUE_FLAG_EVAL_FLIP))
+        return OP_KIND_OTHER;
+
+    if (
+        IS_END(var)
+        || NOT(IS_FUNCTION(var))
+        || NOT_VAL_FLAG(var, VALUE_FLAG_ENFIXED)
+    ){
+        Add_Guard(c, GUARD_NOT_ENFIX, 0, array, index, slot, NULL);
+        return OP_KIND_NONE;
+    }
+
+    return Op_Kind(VAL_FUNC(var));
+}
+
+
+inline static REBOOL Is_Literal_Block(REBARR *array, REBCNT index) {
+    const RELVAL *v = ARR_AT(array, index);
+    return LOGICAL(
+        NOT_END(v)
+        && IS_BLOCK(v)
+        && NOT_VAL_FLAG(v, VALUE_FLAG_EVAL_FLIP)
+    );
+}
+
+
+static void Compile_List(
+    struct Reb_Compiler *c,
+    REBARR *array,
+    REBCNT index,
+    REBCNT dest
+);
+static REBOOL Compile_Call(
+    struct Reb_Compiler *c,
+    REBARR *array,
+    REBCNT *index,
+    REBCNT dest,
+    REBOOL head
+);
+static REBOOL Compile_Arg(
+    struct Reb_Compiler *c,
+    REBARR *array,
+    REBCNT *index,
+    REBCNT dest,
+    REBOOL last,
+    REBOOL defer
+);
+
+
+// A term is a single value: an inert value, a word for something that isn't
+// a function (or is one taking no arguments), a GET-WORD!, a LIT-WORD! or a
+// GROUP!.  It is what a #tight argument takes, unless that's a call.
+//
+static REBOOL Compile_Term(
+    struct Reb_Compiler *c,
+    REBARR *array,
+    REBCNT *index,
+    REBCNT dest
+){
+    const RELVAL *v = ARR_AT(array, *index);
+    if (IS_END(v) || GET_VAL_FLAG(v, VALUE_FLAG_EVAL_FLIP))
+        return FALSE;
+
+    enum Reb_Kind kind = VAL_TYPE(v);
+    const REBVAL *var;
+    REBCNT slot;
+    REBCNT pc;
+
+    switch (kind) {
+    case REB_WORD:
+        var = Peek_Var(c, v, &slot);
+        if (IS_END(var))
+            return FALSE;
+
+        Note_Lookup(c, *index);
+        if (IS_FUNCTION(var)) {
+            if (
+                GET_VAL_FLAG(var, VALUE_FLAG_ENFIXED)
+                || Call_Arity(VAL_FUNC(var)) != 0
+            ){
+                return FALSE;
+            }
+            Add_Guard(c, GUARD_CALL, 0, array, *index, slot, VAL_FUNC(var));
+            pc = Emit_Insn(c, BC_CALL, dest, array, *index);
+            Note_Ran_Code(c);
+        }
+        else {
+            Add_Guard(c, GUARD_TERM, 0, array, *index, slot, NULL);
+            pc = Emit_Insn(c, BC_GET, dest, array, *index);
+        }
+        c->insns[pc].slot = slot;
+        break;
+
+    case REB_GET_WORD:
+        var = Peek_Var(c, v, &slot);
+        if (IS_END(var))
+            return FALSE;
+        pc = Emit_Insn(c, BC_GET_OPT, dest, array, *index);
+        c->insns[pc].slot = slot;
+        break;
+
+    case REB_LIT_WORD:
+        Emit_Insn(c, BC_LIT_WORD, dest, array, *index);
+        break;
+
+    case REB_GROUP:
+        //
+        // If no code ran before it, the guards of statements in the GROUP!
+        // that don't run code either are checked with this statement's (see
+        // Compile_Statement()).  That's as if they were looked up here.
+        //
+        if (NOT(c->seg.ran_code))
+            Note_Lookup(c, *index);
+        c->in_group = TRUE;
+        Compile_List(c, VAL_ARRAY(v), VAL_INDEX(v), dest);
+        c->in_group = FALSE;
+        break;
+
+    default:
+        if (
+            (NOT(IS_KIND_INERT(kind)) && kind != REB_REFINEMENT
+                && kind != REB_ISSUE)
+            || kind == REB_BAR
+            || kind == REB_LIT_BAR
+        ){
+            return FALSE;
+        }
+        Emit_Insn(c, BC_LITERAL, dest, array, *index);
+        break;
+    }
+
+    ++*index;
+    return TRUE;
+}
+
+
+// Compile the enfix operator at `index`, with `dest` as its left hand side.
+//
+static REBOOL Compile_Op(
+    struct Reb_Compiler *c,
+    REBARR *array,
+    REBCNT *index,
+    REBCNT dest,
+    REBCNT kind
+){
+    REBCNT slot;
+    const REBVAL *var = Peek_Var(c, ARR_AT(array, *index), &slot);
+    assert(IS_FUNCTION(var));
+    REBFUN *fun = VAL_FUNC(var);
+    Add_Guard(c, GUARD_OP, kind, array, *index, slot, fun);
+
+    REBCNT op_index = *index;
+    ++*index;
+
+    REBCNT mark = c->next_reg;
+    REBCNT fn = NOT_FOUND;
+    if (
+        NOT(Inert_Terms(c, array, *index, 1))
+        || (
+            kind == OP_KIND_DEFERRED
+            && Is_Enfix_Word(c, ARR_AT(array, *index + 1))
+        )
+    ){
+        fn = Fetch_Fun(c, array, op_index, slot);
+    }
+    REBCNT right = Alloc_Regs(c, 1);
+    if (kind == OP_KIND_TIGHT) {
+        //
+        // A call on the right takes all of what follows for its arguments,
+        // e.g. `n + f n - 1` is `n + (f (n - 1))`.
+        //
+        REBCNT arity = Call_Word_Arity(c, ARR_AT(array, *index));
+        if (arity != NOT_FOUND && arity != 0) {
+            if (NOT(Compile_Call(c, array, index, right, FALSE)))
+                return FALSE;
+        }
+        else if (NOT(Compile_Term(c, array, index, right)))
+            return FALSE;
+    }
+    else {
+        if (NOT(Compile_Arg(c, array, index, right, TRUE, TRUE)))
+            return FALSE;
+    }
+
+    REBCNT pc = Emit_Insn(c, BC_ENFIX, dest, array, op_index);
+    c->insns[pc].end = *index;
+    c->insns[pc].a = dest;
+    c->insns[pc].b = right;
+    c->insns[pc].c = kind;
+    c->insns[pc].slot = slot;
+    c->insns[pc].fn = fn;
+    Note_Op(c, pc, fun);
+
+    c->next_reg = mark;
+    return TRUE;
+}
+
+
+// Terms joined by #tight operators, e.g. `x + 1 * y`.  If it's at the `top`
+// of the statement, the operators may be checked for (see Check_Before_Op()).
+//
+static REBOOL Compile_Tight_Chain(
+    struct Reb_Compiler *c,
+    REBARR *array,
+    REBCNT *index,
+    REBCNT dest,
+    REBOOL top
+){
+    if (NOT(Compile_Term(c, array, index, dest)))
+        return FALSE;
+
+    while (Peek_Op(c, array, *index) == OP_KIND_TIGHT) {
+        if (top && NOT(Check_Before_Op(c, array, *index, dest)))
+            return FALSE;
+        if (NOT(Compile_Op(c, array, index, dest, OP_KIND_TIGHT)))
+            return FALSE;
+    }
+    return TRUE;
+}
+
+
+static REBOOL Compile_Call(
+    struct Reb_Compiler *c,
+    REBARR *array,
+    REBCNT *index,
+    REBCNT dest,
+    REBOOL head
+){
+    REBCNT slot;
+    const REBVAL *var = Peek_Var(c, ARR_AT(array, *index), &slot);
+    REBCNT arity = Call_Arity(VAL_FUNC(var));
+    assert(arity != NOT_FOUND);
+    Note_Lookup(c, *index);
+    Add_Guard(c, GUARD_CALL, arity, array, *index, slot, VAL_FUNC(var));
+
+    REBCNT call_index = *index;
+    ++*index;
+
+    REBCNT mark = c->next_reg;
+    REBCNT fn = NOT_FOUND;
+    if (
+        arity != 0
+        && (
+            NOT(Inert_Terms(c, array, *index, arity))
+            || Is_Enfix_Word(c, ARR_AT(array, *index + arity))
+        )
+    ){
+        fn = Fetch_Fun(c, array, call_index, slot);
+    }
+    REBCNT args = Alloc_Regs(c, arity);
+    REBCNT n;
+    for (n = 0; n < arity; ++n) {
+        REBOOL last = LOGICAL(n == arity - 1);
+        if (NOT(Compile_Arg(
+            c, array, index, args + n, last, LOGICAL(head && last)
+        ))){
+            return FALSE;
+        }
+    }
+
+    REBCNT pc = Emit_Insn(c, BC_CALL, dest, array, call_index);
+    c->insns[pc].end = *index;
+    c->insns[pc].a = args;
+    c->insns[pc].b = arity;
+    c->insns[pc].slot = slot;
+    c->insns[pc].fn = fn;
+    Note_Ran_Code(c);
+
+    c->next_reg = mark;
+    return TRUE;
+}
+
+
+// An argument is a call or a chain of terms and operators.  Operators like
+// `=` that follow the last argument of a call apply to the call's result,
+// e.g. `length? x = 1` is `(length? x) = 1`.  That is only compiled if the
+// call is what the caller is chaining operators after (`defer`).
+//
+static REBOOL Compile_Arg(
+    struct Reb_Compiler *c,
+    REBARR *array,
+    REBCNT *index,
+    REBCNT dest,
+    REBOOL last,
+    REBOOL defer
+){
+    REBCNT arity = Call_Word_Arity(c, ARR_AT(array, *index));
+    if (arity != NOT_FOUND && arity != 0) {
+        if (NOT(Compile_Call(c, array, index, dest, FALSE)))
+            return FALSE;
+        return LOGICAL(Peek_Op(c, array, *index) == OP_KIND_NONE);
+    }
+
+    if (NOT(Compile_Tight_Chain(c, array, index, dest, FALSE)))
+        return FALSE;
+
+    while (TRUE) {
+        REBCNT kind = Peek_Op(c, array, *index);
+        if (kind == OP_KIND_NONE)
+            return TRUE;
+
+        if (kind != OP_KIND_DEFERRED)
+            return FALSE;
+
+        if (defer)
+            return TRUE; // operator applies to what's being chained
+
+        if (last)
+            return FALSE; // operator applies to result of unknown call
+
+        if (NOT(Compile_Op(c, array, index, dest, kind)))
+            return FALSE;
+    }
+}
+
+
+static REBOOL Compile_Chain(
+    struct Reb_Compiler *c,
+    REBARR *array,
+    REBCNT *index,
+    REBCNT dest
+){
+    REBCNT arity = Call_Word_Arity(c, ARR_AT(array, *index));
+    if (arity != NOT_FOUND && arity != 0) {
+        if (NOT(Compile_Call(c, array, index, dest, TRUE)))
+            return FALSE;
+    }
+    else if (NOT(Compile_Tight_Chain(c, array, index, dest, TRUE)))
+        return FALSE;
+
+    while (TRUE) {
+        REBCNT kind = Peek_Op(c, array, *index);
+        if (kind == OP_KIND_NONE)
+            return TRUE;
+
+        if (kind == OP_KIND_OTHER)
+            return FALSE;
+
+        if (NOT(Check_Before_Op(c, array, *index, dest)))
+            return FALSE;
+        if (NOT(Compile_Op(c, array, index, dest, kind)))
+            return FALSE;
+    }
+}
+
+
+// IF, EITHER, LOOP and WHILE when their branches or bodies are literal
+// blocks (and without refinements, which a WORD! can't have).
+//
+static REBOOL Compile_Control(
+    struct Reb_Compiler *c,
+    REBARR *array,
+    REBCNT *index,
+    REBCNT dest,
+    REBFUN *fun,
+    REBCNT slot
+){
+    REBCNT word_index = *index;
+    Note_Lookup(c, word_index);
+    Add_Guard(c, GUARD_NATIVE, 0, array, word_index, slot, fun);
+    ++*index;
+
+    REBCNT mark = c->next_reg;
+    REBCNT outer = c->loop;
+    REBCNT outer_ctl = c->ctl;
+    REBCNT start;
+    REBCNT pc;
+    const RELVAL *block;
+
+    if (fun == NAT_FUNC(if) || fun == NAT_FUNC(either)) {
+        REBCNT branches = (fun == NAT_FUNC(if)) ? 1 : 2;
+        REBCNT cond = Alloc_Regs(c, 1 + branches); // natives need branches
+
+        if (NOT(Compile_Arg(c, array, index, cond, FALSE, FALSE)))
+            return FALSE;
+        if (NOT(Is_Literal_Block(array, *index)))
+            return FALSE;
+        if (branches == 2 && NOT(Is_Literal_Block(array, *index + 1)))
+            return FALSE;
+
+        start = Emit_Insn(c, BC_IF_FALSE, dest, array, word_index);
+        c->insns[start].a = cond;
+        c->insns[start].c = branches;
+        c->insns[start].end = *index; // native only runs to reject `cond`
+        c->insns[start].block = *index;
+        c->insns[start].fun = fun;
+        c->ctl = start;
+
+        block = ARR_AT(array, *index);
+        Compile_List(c, VAL_ARRAY(block), VAL_INDEX(block), dest);
+        Emit_Insn(c, BC_BLANKIFY, dest, array, *index);
+        pc = Emit_Insn(c, BC_JUMP, dest, array, *index);
+        ++*index;
+
+        c->insns[start].b = c->num_insns;
+        if (branches == 1)
+            Emit_Insn(c, BC_VOID, dest, array, word_index);
+        else {
+            block = ARR_AT(array, *index);
+            Compile_List(c, VAL_ARRAY(block), VAL_INDEX(block), dest);
+            Emit_Insn(c, BC_BLANKIFY, dest, array, *index);
+            ++*index;
+        }
+
+        c->insns[pc].c = c->num_insns;
+        c->insns[start].d = c->num_insns;
+    }
+    else if (fun == NAT_FUNC(loop)) {
+        REBCNT count = Alloc_Regs(c, 2); // native needs body
+        REBCNT counter = Alloc_Regs(c, 1);
+
+        if (NOT(Compile_Arg(c, array, index, count, FALSE, FALSE)))
+            return FALSE;
+        if (NOT(Is_Literal_Block(array, *index)))
+            return FALSE;
+
+        start = Emit_Insn(c, BC_LOOP_START, dest, array, word_index);
+        c->insns[start].a = count;
+        c->insns[start].b = counter;
+        c->insns[start].end = *index; // native only runs to reject `count`
+        c->insns[start].block = *index;
+        c->insns[start].fun = fun;
+        c->ctl = start;
+
+        REBCNT top = c->num_insns;
+        c->loop = start;
+        block = ARR_AT(array, *index);
+        Compile_List(c, VAL_ARRAY(block), VAL_INDEX(block), dest);
+        Emit_Insn(c, BC_BLANKIFY, dest, array, *index);
+        c->loop = outer;
+        ++*index;
+
+        pc = Emit_Insn(c, BC_LOOP_NEXT, dest, array, word_index);
+        c->insns[pc].a = count;
+        c->insns[pc].b = counter;
+        c->insns[pc].c = top;
+        Emit_Insn(c, BC_TRUTHIFY, dest, array, word_index);
+
+        c->insns[start].c = c->num_insns; // BREAK
+        c->insns[start].d = pc; // CONTINUE
+    }
+    else {
+        assert(fun == NAT_FUNC(while));
+
+        if (
+            NOT(Is_Literal_Block(array, *index))
+            || NOT(Is_Literal_Block(array, *index + 1))
+        ){
+            return FALSE;
+        }
+
+        REBCNT ran = Alloc_Regs(c, 1);
+        REBCNT cond = Alloc_Regs(c, 1);
+
+        start = Emit_Insn(c, BC_WHILE_START, dest, array, word_index);
+        c->insns[start].b = ran;
+        c->ctl = start;
+
+        REBCNT top = c->num_insns;
+        block = ARR_AT(array, *index);
+        Compile_List(c, VAL_ARRAY(block), VAL_INDEX(block), cond); // outer
+        REBCNT test = Emit_Insn(c, BC_WHILE_TEST, dest, array, *index);
+        c->insns[test].a = cond;
+        ++*index;
+
+        c->loop = start;
+        block = ARR_AT(array, *index);
+        Compile_List(c, VAL_ARRAY(block), VAL_INDEX(block), dest);
+        Emit_Insn(c, BC_BLANKIFY, dest, array, *index);
+        c->loop = outer;
+        ++*index;
+
+        pc = Emit_Insn(c, BC_WHILE_NEXT, dest, array, word_index);
+        c->insns[pc].b = ran;
+        c->insns[pc].c = top;
+
+        REBCNT finish = Emit_Insn(c, BC_WHILE_FINISH, dest, array, word_index);
+        c->insns[finish].b = ran;
+        c->insns[test].c = finish;
+
+        c->insns[start].c = c->num_insns; // BREAK
+        c->insns[start].d = pc; // CONTINUE
+    }
+
+    c->ctl = outer_ctl;
+
+    Note_Ran_Code(c);
+    c->next_reg = mark;
+    return TRUE;
+}
+
+
+static REBOOL Compile_Expression(
+    struct Reb_Compiler *c,
+    REBARR *array,
+    REBCNT *index,
+    REBCNT dest
+){
+    REBCNT sets = *index;
+    REBCNT slot;
+    const REBVAL *var;
+
+    while (IS_SET_WORD(ARR_AT(array, *index))) {
+        if (IS_END(Peek_Var(c, ARR_AT(array, *index), &slot)))
+            return FALSE;
+        ++*index;
+    }
+    REBCNT num_sets = *index - sets;
+
+    const RELVAL *v = ARR_AT(array, *index);
+    if (IS_END(v) || GET_VAL_FLAG(v, VALUE_FLAG_EVAL_FLIP))
+        return FALSE;
+
+    if (IS_BAR(v)) {
+        if (num_sets != 0)
+            return FALSE;
+        Emit_Insn(c, BC_VOID, dest, array, *index);
+        ++*index;
+    }
+    else {
+        var = IS_WORD(v) ? Peek_Var(c, v, &slot) : END;
+        if (
+            NOT_END(var)
+            && IS_FUNCTION(var)
+            && NOT_VAL_FLAG(var, VALUE_FLAG_ENFIXED)
+            && (
+                VAL_FUNC(var) == NAT_FUNC(if)
+                || VAL_FUNC(var) == NAT_FUNC(either)
+                || VAL_FUNC(var) == NAT_FUNC(loop)
+                || VAL_FUNC(var) == NAT_FUNC(while)
+            )
+        ){
+            if (NOT(Compile_Control(
+                c, array, index, dest, VAL_FUNC(var), slot
+            ))){
+                return FALSE;
+            }
+        }
+        else if (NOT(Compile_Chain(c, array, index, dest)))
+            return FALSE;
+    }
+
+    if (Peek_Op(c, array, *index) != OP_KIND_NONE)
+        return FALSE;
+
+    while (num_sets != 0) {
+        --num_sets;
+        Peek_Var(c, ARR_AT(array, sets + num_sets), &slot);
+        REBCNT pc = Emit_Insn(c, BC_SET, dest, array, sets + num_sets);
+        c->insns[pc].end = *index;
+        c->insns[pc].a = dest;
+        c->insns[pc].slot = slot;
+        Note_Ran_Code(c);
+    }
+    return TRUE;
+}
+
+
+// If the statement compiled from `stmt` is just a call, and it's the last one
+// of the body or the argument of a RETURN, make it a BC_TAIL_CALL.  In the
+// RETURN case the CALL of the RETURN is kept after it, for if the tail call
+// can't be done.  (Calls in tail position of IF or EITHER branches aren't
+// done, as the branch result isn't always the result of the body.)
+//
+static void Mark_Tail_Call(
+    struct Reb_Compiler *c,
+    REBARR *array,
+    REBCNT index,
+    REBCNT stmt
+){
+    struct Reb_Insn *i = &c->insns[c->num_insns - 1];
+    if (
+        i->op != BC_CALL
+        || i->index != c->insns[stmt].index
+        || i->dest != c->insns[stmt].dest
+    ){
+        return;
+    }
+
+    if (
+        i->slot == 0 // RETURN is a local of the frame
+        || VAL_FUNC(FRM_ARG(c->f, i->slot)) != NAT_FUNC(return)
+    ){
+        if (array == c->body && IS_END(ARR_AT(array, index))) {
+            i->op = BC_TAIL_CALL;
+            i->c = 0;
+        }
+        return;
+    }
+
+    struct Reb_Insn *arg = i - 1; // the BC_STMT if not a call
+    if (
+        arg->op == BC_CALL
+        && arg->dest == i->a
+        && arg->array == array
+        && arg->index == i->index + 1
+    ){
+        arg->op = BC_TAIL_CALL;
+        arg->c = 1;
+    }
+}
+
+
+// Compile the statement at `index` and return its BC_STMT, or a BC_FALLBACK
+// if it couldn't be compiled.  In that case where the statement ends isn't
+// known, so compiling carries on from the next value.  Statements compiled
+// from the middle of one that wasn't are only used if a DO/NEXT stops there.
+//
+// A statement in a GROUP! which doesn't run code, in a statement which has
+// not run code before it, leaves its guards to be checked along with those
+// of the statement the GROUP! is in.  Otherwise what may run code includes
+// the statement, as its guards failing means it falls back.
+//
+static REBCNT Compile_Statement(
+    struct Reb_Compiler *c,
+    REBARR *array,
+    REBCNT *index,
+    REBCNT dest
+){
+    REBCNT start = *index;
+    REBCNT num_pending = c->num_pending;
+    REBCNT num_guards = c->num_guards;
+    REBCNT num_ops = c->num_ops;
+    REBCNT next_reg = c->next_reg;
+    REBCNT loop = c->loop;
+
+    struct Reb_Segment outer = c->seg;
+    REBOOL in_group = c->in_group;
+    c->in_group = FALSE;
+
+    REBCNT stmt = Emit_Insn(c, BC_STMT, dest, array, start);
+    c->seg.stmt = stmt;
+    c->seg.stmt_ran_code = FALSE;
+    Start_Segment(c, stmt);
+
+    REBOOL merged = FALSE;
+    if (
+        Compile_Expression(c, array, index, dest)
+        && End_Segment(c, *index)
+    ){
+        merged = LOGICAL(
+            in_group && NOT(outer.ran_code) && NOT(c->seg.stmt_ran_code)
+        );
+        if (merged) {
+            c->insns[stmt].a = c->num_guards;
+            c->insns[stmt].d = 0;
+        }
+        else
+            Flush_Guards(c, c->seg.guards, c->seg.check);
+
+        Mark_Tail_Call(c, array, *index, stmt);
+        ++c->num_compiled;
+    }
+    else {
+        c->num_insns = stmt;
+        c->num_pending = num_pending;
+        c->num_guards = num_guards;
+        c->next_reg = next_reg;
+        c->loop = loop;
+        *index = start + 1;
+        stmt = Emit_Insn(c, BC_FALLBACK, dest, array, start);
+    }
+
+    c->seg = outer;
+    c->in_group = in_group;
+    if (NOT(merged)) {
+        c->num_ops = num_ops;
+        Note_Ran_Code(c);
+    }
+    return stmt;
+}
+
+
+// The result of the statements of the array from `index` is put in `dest`,
+// and the statements are linked so a fallback can find where to resume.
+//
+static void Compile_List(
+    struct Reb_Compiler *c,
+    REBARR *array,
+    REBCNT index,
+    REBCNT dest
+){
+    Emit_Insn(c, BC_VOID, dest, array, index);
+
+    REBCNT first = NOT_FOUND;
+    REBCNT prior = NOT_FOUND;
+    while (NOT_END(ARR_AT(array, index))) {
+        REBCNT stmt = Compile_Statement(c, array, &index, dest);
+        if (prior == NOT_FOUND)
+            first = stmt;
+        else
+            c->insns[prior].b = stmt;
+        prior = stmt;
+    }
+
+    if (prior == NOT_FOUND)
+        return;
+
+    REBCNT end = c->num_insns;
+    c->insns[prior].b = end;
+
+    REBCNT pc;
+    for (pc = first; pc != end; pc = c->insns[pc].b)
+        c->insns[pc].c = end;
+}
+
+
+static struct Reb_Bytecode *Compile_Bytecode(REBFRM *f, REBARR *body)
+{
+    struct Reb_Compiler c;
+    CLEAR(&c, sizeof(c));
+    c.f = f;
+    c.body = body;
+    c.loop = NOT_FOUND;
+    c.ctl = NOT_FOUND;
+
+    REBCNT result = Alloc_Regs(&c, 1);
+    assert(result == 0);
+    Compile_List(&c, body, 0, result);
+    Emit_Insn(&c, BC_END, result, body, 0);
+    assert(c.num_pending == 0);
+
+    struct Reb_Bytecode *code = ALLOC(struct Reb_Bytecode);
+    code->body = body;
+    code->num_regs = c.num_regs;
+
+    if (c.num_compiled == 0) {
+        code->insns = NULL; // body is only run by Do_Core()
+        code->num_insns = 0;
+        code->guards = NULL;
+        code->num_guards = 0;
+    }
+    else {
+        code->num_insns = c.num_insns;
+        code->insns = ALLOC_N(struct Reb_Insn, c.num_insns);
+        memcpy(code->insns, c.insns, c.num_insns * sizeof(struct Reb_Insn));
+
+        code->num_guards = c.num_guards;
+        if (c.num_guards == 0)
+            code->guards = NULL;
+        else {
+            code->guards = ALLOC_N(struct Reb_Guard, c.num_guards);
+            memcpy(
+                code->guards,
+                c.guards,
+                c.num_guards * sizeof(struct Reb_Guard)
+            );
+        }
+    }
+
+    if (c.insns != NULL)
+        Free_Mem(c.insns, c.max_insns * sizeof(struct Reb_Insn));
+    if (c.guards != NULL)
+        Free_Mem(c.guards, c.max_guards * sizeof(struct Reb_Guard));
+    if (c.pending != NULL)
+        Free_Mem(c.pending, c.max_pending * sizeof(struct Reb_Guard));
+    if (c.ops != NULL)
+        Free_Mem(c.ops, c.max_ops * sizeof(REBCNT));
+
+    struct Reb_Bytecode **bucket
+        = &Bytecode_Table[BODY_HASH(body, BYTECODE_BUCKETS)];
+    code->next = *bucket;
+    *bucket = code;
+
+    SET_SER_INFO(body, ARRAY_INFO_BYTECODE);
+    return code;
+}
+
+
+static void Free_Code(struct Reb_Bytecode *code)
+{
+    if (code->insns != NULL)
+        FREE_N(struct Reb_Insn, code->num_insns, code->insns);
+    if (code->guards != NULL)
+        FREE_N(struct Reb_Guard, code->num_guards, code->guards);
+    FREE(struct Reb_Bytecode, code);
+}
+
+
+//
+//  Do_Body_Throws: C
+//
+// Run the body of the interpreted function in frame `f`, into f->out.  This
+// is what the FUNC dispatchers use instead of Do_At_Throws(), so that a body
+// that is called often gets compiled.  (If the evaluator or function calls
+// are hooked, e.g. by TRACE, the body is always run by the evaluator.)
+//
+// If the body ended in a tail call, f->out is left as an END and the frame
+// has been switched over to the called function and its arguments.  Then
+// the dispatcher should return R_REDO_CHECKED to have Do_Core() run it.
+//
+REBOOL Do_Body_Throws(REBFRM *f)
+{
+    RELVAL *body = FUNC_BODY(f->phase);
+    assert(IS_BLOCK(body) && IS_RELATIVE(body) && VAL_INDEX(body) == 0);
+
+    REBARR *array = VAL_ARRAY(body);
+
+    if (PG_Do == &Do_Core && PG_Apply == &Apply_Core) {
+        struct Reb_Bytecode *code = NULL;
+
+        if (GET_SER_INFO(array, ARRAY_INFO_BYTECODE))
+            code = Find_Bytecode(array);
+        else if (GET_SER_INFO(array, SERIES_INFO_FROZEN)) {
+            struct Reb_Call_Counter *counter
+                = &Call_Counters[BODY_HASH(array, CALL_COUNTERS)];
+
+            if (counter->body != array) {
+                counter->body = array;
+                counter->count = 0;
+            }
+            if (++counter->count == BYTECODE_THRESHOLD) {
+                counter->body = NULL;
+                code = Compile_Bytecode(f, array);
+            }
+        }
+
+        if (code != NULL && code->insns != NULL)
+            return Run_Bytecode_Throws(f, code);
+    }
+
+    return Do_At_Throws(
+        f->out,
+        array,
+        0, // VAL_INDEX(body) asserted 0 above
+        AS_SPECIFIER(f)
+    );
+}
+
+
+// The code and instruction that frame `f` is at, if it's running a compiled
+// body in a Run_Bytecode_Throws() in progress.  A frame waiting on a call to
+// another compiled body is at the instruction of the call.
+//
+static struct Reb_Bytecode *Find_Compiled_Insn(REBCNT *pc, REBFRM *f)
+{
+    struct Reb_Continuation *top = TG_Continuation;
+    struct Reb_Bytecode_Run *run = TG_Bytecode_Run;
+    for (; run != NULL; top = run->cont_base, run = run->prior) {
+        if (run->f == f) {
+            if (
+                run->pc == NOT_FOUND
+                || run->code->insns[run->pc].op == BC_END
+            ){
+                return NULL; // not running the body (or done with it)
+            }
+            *pc = run->pc;
+            return run->code;
+        }
+
+        struct Reb_Continuation *cont = top;
+        for (; cont != run->cont_base; cont = cont->prior) {
+            REBFRM *caller = (cont->prior == run->cont_base)
+                ? run->base
+                : &cont->prior->frame;
+            if (caller == f) {
+                *pc = cont->pc;
+                return cont->code;
+            }
+        }
+    }
+    return NULL;
+}
+
+
+//
+//  Get_Compiled_Position: C
+//
+// The frame running a compiled body, and the frames of the calls it makes,
+// aren't at a position in the body the way a Do_Core() frame would be.  If
+// `f` is one of them, give the array and index that the evaluator would be
+// at (past the expression being run) and the specifier for it, for errors
+// and NEAR-OF to show.
+//
+REBOOL Get_Compiled_Position(
+    REBARR **array,
+    REBCNT *index,
+    REBSPC **specifier,
+    REBFRM *f
+){
+    if (TG_Bytecode_Run == NULL)
+        return FALSE;
+
+    REBCNT pc;
+    struct Reb_Bytecode *code = Find_Compiled_Insn(&pc, f);
+    if (code == NULL) {
+        if (NOT(f->flags.bits & DO_FLAG_APPLYING) || f->prior == NULL)
+            return FALSE;
+
+        f = f->prior; // a call is at the position of its caller
+        code = Find_Compiled_Insn(&pc, f);
+        if (code == NULL)
+            return FALSE;
+    }
+
+    *array = code->insns[pc].array;
+    *index = code->insns[pc].end;
+    *specifier = AS_SPECIFIER(f);
+    return TRUE;
+}
+
+
+//
+//  Push_Compiled_Labels: C
+//
+// Compiled IF, EITHER, LOOP and WHILE don't call their natives, so there is
+// no frame for them.  If `f` is running a compiled body, push words for the
+// ones it's inside of on the data stack (innermost first), as the labels of
+// those frames would be in the WHERE of an error.
+//
+void Push_Compiled_Labels(REBFRM *f)
+{
+    if (TG_Bytecode_Run == NULL)
+        return;
+
+    REBCNT pc;
+    struct Reb_Bytecode *code = Find_Compiled_Insn(&pc, f);
+    if (code == NULL)
+        return;
+
+    REBCNT n = code->insns[pc].ctl;
+    while (n != NOT_FOUND) {
+        struct Reb_Insn *i = &code->insns[n];
+        DS_PUSH_TRASH;
+        Init_Word(DS_TOP, VAL_WORD_SPELLING(ARR_AT(i->array, i->index)));
+        n = i->ctl;
+    }
+}
+
+
+//
+//  Free_Bytecode: C
+//
+// Called by GC_Kill_Series() for a body with ARRAY_INFO_BYTECODE.
+//
+void Free_Bytecode(REBARR *body)
+{
+    struct Reb_Bytecode **link
+        = &Bytecode_Table[BODY_HASH(body, BYTECODE_BUCKETS)];
+    while (*link != NULL) {
+        if ((*link)->body == body) {
+            struct Reb_Bytecode *code = *link;
+            *link = code->next;
+            Free_Code(code);
+            return;
+        }
+        link = &(*link)->next;
+    }
+    assert(FALSE); // flag is only set when the body is put in the table
+}
+
+
+//
+//  Startup_Bytecode: C
+//
+void Startup_Bytecode(void)
+{
+    CLEAR(Bytecode_Table, sizeof(Bytecode_Table));
+    CLEAR(Call_Counters, sizeof(Call_Counters));
+    Continuations = NULL;
+    TG_Continuation = NULL;
+    TG_Bytecode_Run = NULL;
+}
+
+
+//
+//  Shutdown_Bytecode: C
+//
+// Bodies are freed by the shutdown recycle, so normally nothing is left.
+//
+void Shutdown_Bytecode(void)
+{
+    REBCNT n;
+    for (n = 0; n < BYTECODE_BUCKETS; ++n) {
+        while (Bytecode_Table[n] != NULL) {
+            struct Reb_Bytecode *code = Bytecode_Table[n];
+            Bytecode_Table[n] = code->next;
+            CLEAR_SER_INFO(code->body, ARRAY_INFO_BYTECODE);
+            Free_Code(code);
+        }
+    }
+
+    assert(TG_Continuation == NULL);
+    while (Continuations != NULL) {
+        struct Reb_Continuation *cont = Continuations;
+        Continuations = cont->next;
+        FREE(struct Reb_Continuation, cont);
+    }
+}
@@ -111,6 +111,138 @@ REBCTX *Alloc_Context(enum Reb_Kind kind, REBCNT capacity)
 }
 
 
+// Keylists with more than KEY_INDEX_MIN_LEN keys get a hash index the first
+// time they are searched, giving the position of the first key for a canon.
+// When used again, the index first catches up with keys that were appended
+// since--so Append_Context() and others adding keys needn't know about it.
+//
+// What's hashed is the canon's pointer.  That goes stale if the canon is
+// GC'd and a synonym takes over, which PG_Canon_Epoch tells us about.
+//
+#define KEY_INDEX_MIN_LEN 16
+
+struct Reb_Key_Index {
+    REBCNT size; // number of slots, a power of 2
+    REBCNT len; // keys 1 through len are in the slots
+    REBCNT epoch; // PG_Canon_Epoch when the keys were hashed
+    REBCNT slots[1]; // key positions (0 for an empty slot)
+};
+
+#define Key_Index_Bytes(size) \
+    (offsetof(struct Reb_Key_Index, slots) + sizeof(REBCNT) * (size))
+
+//
+//  Make_Key_Index: C
+//
+static struct Reb_Key_Index *Make_Key_Index(REBCNT len)
+{
+    REBCNT size = KEY_INDEX_MIN_LEN * 2;
+    while (size < len * 2)
+        size *= 2; // keep the slots no more than half full
+
+    struct Reb_Key_Index *index = cast(
+        struct Reb_Key_Index*, Alloc_Mem(Key_Index_Bytes(size))
+    );
+    index->size = size;
+    index->len = 0;
+    index->epoch = PG_Canon_Epoch;
+    CLEAR(index->slots, sizeof(REBCNT) * size);
+    return index;
+}
+
+
+//
+//  Free_Key_Index: C
+//
+// Called by GC_Kill_Series() for a keylist with KEYLIST_INFO_INDEXED.
+//
+void Free_Key_Index(REBARR *keylist)
+{
+    assert(GET_SER_INFO(keylist, KEYLIST_INFO_INDEXED));
+
+    struct Reb_Key_Index *index = LINK(keylist).key_index;
+    Free_Mem(index, Key_Index_Bytes(index->size));
+    CLEAR_SER_INFO(keylist, KEYLIST_INFO_INDEXED);
+}
+
+
+//
+//  Update_Key_Index: C
+//
+// Gives the keylist's index with all its keys in it, or NULL if it's not
+// worth having one.
+//
+static struct Reb_Key_Index *Update_Key_Index(REBARR *keylist)
+{
+    REBCNT len = ARR_LEN(keylist) - 1;
+
+    struct Reb_Key_Index *index;
+    if (GET_SER_INFO(keylist, KEYLIST_INFO_INDEXED)) {
+        index = LINK(keylist).key_index;
+        if (index->len == len && index->epoch == PG_Canon_Epoch)
+            return index;
+
+        if (
+            index->epoch != PG_Canon_Epoch
+            || index->len > len
+            || len * 2 > index->size
+        ){
+            Free_Key_Index(keylist); // rehash into a fresh one
+            return Update_Key_Index(keylist);
+        }
+    }
+    else {
+        if (
+            len <= KEY_INDEX_MIN_LEN
+            || GET_SER_FLAG(keylist, ARRAY_FLAG_PARAMLIST)
+            || GET_SER_INFO(keylist, SERIES_INFO_ARENA)
+        ){
+            return NULL;
+        }
+        index = Make_Key_Index(len);
+        LINK(keylist).key_index = index;
+        SET_SER_INFO(keylist, KEYLIST_INFO_INDEXED);
+    }
+
+    REBCNT n;
+    for (n = index->len + 1; n <= len; ++n) {
+        REBSTR *canon = VAL_KEY_CANON(ARR_AT(keylist, n));
+        REBCNT h = Hash_Canon(canon, index->size);
+        while (index->slots[h] != 0) {
+            if (VAL_KEY_CANON(ARR_AT(keylist, index->slots[h])) == canon)
+                break; // only the first key with a canon is found
+            h = (h + 1) & (index->size - 1);
+        }
+        if (index->slots[h] == 0)
+            index->slots[h] = n;
+    }
+    index->len = len;
+
+    return index;
+}
+
+
+//
+//  Copy_Key_Index: C
+//
+// A copy of a keylist can start out with the index of the original, instead
+// of building its own when it is first searched.
+//
+static void Copy_Key_Index(REBARR *copy, REBARR *keylist)
+{
+    if (NOT_SER_INFO(keylist, KEYLIST_INFO_INDEXED))
+        return;
+
+    assert(NOT_SER_INFO(copy, KEYLIST_INFO_INDEXED));
+
+    struct Reb_Key_Index *index = LINK(keylist).key_index;
+    REBCNT bytes = Key_Index_Bytes(index->size);
+    LINK(copy).key_index = cast(struct Reb_Key_Index*, Alloc_Mem(bytes));
+    memcpy(LINK(copy).key_index, index, bytes);
+    SET_SER_INFO(copy, KEYLIST_INFO_INDEXED);
+}
+
+
 //
 //  Expand_Context_Keylist_Core: C
 //
@@ -136,7 +268,9 @@ REBOOL Expand_Context_Keylist_Core(REBCTX *context, REBCNT delta)
         //
         // Keylists are only typesets, so no need for a specifier.
 
-        keylist = Copy_Array_Extra_Shallow(keylist, SPECIFIED, delta);
+        REBARR *copy = Copy_Array_Extra_Shallow(keylist, SPECIFIED, delta);
+        Copy_Key_Index(copy, keylist);
+        keylist = copy;
 
         MANAGE_ARRAY(keylist);
         INIT_CTX_KEYLIST_UNIQUE(context, keylist);
@@ -372,12 +506,9 @@ void Collect_End(struct Reb_Collector *cl)
         // keys with.  The nature of handling error states means that if
         // a thread-safe binding system was implemented, we'd have to know
         // which thread had the error to roll back any binding structures.
-        // For now just zero it out based on the collect buffer.
+        // For now just zero it out based on the collect buffer.  (If the
+        // binder had moved its indices into a table, the canons are zero.)
         //
-        assert(
-            MISC(canon).bind_index.high != 0
-            || MISC(canon).bind_index.low != 0
-        );
         MISC(canon).bind_index.high = 0;
         MISC(canon).bind_index.low = 0;
     }
@@ -568,6 +699,8 @@ REBARR *Collect_Keylist_Managed(
 
     assert(NOT(flags & COLLECT_AS_TYPESET)); // not optional, we add it
     Collect_Start(cl, flags | COLLECT_AS_TYPESET);
+    if (prior)
+        Size_Binder(&cl->binder, CTX_LEN(prior) + 1); // +1 if SELF is added
 
     // Leave the [0] slot blank while collecting (ROOTKEY/ROOTPARAM), but
     // valid (but "unreadable") bits so that the copy will still work.
@@ -1295,6 +1428,36 @@ REBCNT Find_Canon_In_Context(REBCTX *context, REBSTR *canon, REBOOL always)
     REBCNT len = CTX_LEN(context);
 
     REBCNT n;
+
+    struct Reb_Key_Index *index;
+    if (
+        len > KEY_INDEX_MIN_LEN
+        && CTX_TYPE(context) != REB_FRAME
+        && (index = Update_Key_Index(CTX_KEYLIST(context))) != NULL
+    ){
+        REBCNT h = Hash_Canon(canon, index->size);
+        while ((n = index->slots[h]) != 0) {
+            if (VAL_KEY_CANON(key + n - 1) == canon)
+                break;
+            h = (h + 1) & (index->size - 1);
+        }
+
+    #if !defined(NDEBUG)
+        REBCNT check;
+        for (check = 1; check <= len; ++check) {
+            if (VAL_KEY_CANON(key + check - 1) == canon)
+                break;
+        }
+        assert(check == (n == 0 || n > len ? len + 1 : n));
+    #endif
+
+        if (n == 0 || n > len)
+            return 0;
+
+        key += n - 1;
+        return (!always && GET_VAL_FLAG(key, TYPESET_FLAG_HIDDEN)) ? 0 : n;
+    }
+
     for (n = 1; n <= len; n++, key++) {
         if (canon == VAL_KEY_CANON(key))
             return (!always && GET_VAL_FLAG(key, TYPESET_FLAG_HIDDEN)) ? 0 : n;
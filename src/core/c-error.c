@@ -50,6 +50,8 @@ void Snap_State_Core(struct Reb_State *s)
 
     s->dsp = DSP;
     s->top_chunk = TG_Top_Chunk;
+    s->continuation = TG_Continuation;
+    s->bytecode_run = TG_Bytecode_Run;
 
     // There should not be a Collect_Keys in progress.  (We use a non-zero
     // length of the collect buffer to tell if a later fail() happens in
@@ -61,6 +63,7 @@ void Snap_State_Core(struct Reb_State *s)
     s->frame = FS_TOP;
 
     s->manuals_len = SER_LEN(GC_Manuals);
+    s->arena_mark = Push_Arena();
     s->uni_buf_len = SER_LEN(UNI_BUF);
     s->mold_loop_tail = ARR_LEN(TG_Mold_Stack);
 
@@ -92,6 +95,9 @@ void Assert_State_Balanced_Debug(
 
     assert(s->top_chunk == TG_Top_Chunk);
 
+    assert(s->continuation == TG_Continuation);
+    assert(s->bytecode_run == TG_Bytecode_Run);
+
     assert(s->frame == FS_TOP);
 
     assert(ARR_LEN(BUF_COLLECT) == 0);
@@ -138,6 +144,11 @@ void Assert_State_Balanced_Debug(
         panic_at (manual, file, line);
     }
 
+    if (s->arena_mark != Push_Arena()) {
+        printf("Push_Arena() without Drop_Arena()\n");
+        panic_at (NULL, file, line);
+    }
+
     assert(s->uni_buf_len == SER_LEN(UNI_BUF));
     assert(s->mold_loop_tail == ARR_LEN(TG_Mold_Stack));
 
@@ -182,6 +193,12 @@ REBOOL Trapped_Helper_Halted(struct Reb_State *s)
     while (TG_Top_Chunk != s->top_chunk)
         Drop_Chunk_Of_Values(NULL);
 
+    // Calls run in continuations whose frames were dropped are over, but
+    // the continuations are kept to be reused (see %c-bytecode.c)
+    //
+    TG_Continuation = s->continuation;
+    TG_Bytecode_Run = s->bytecode_run;
+
     // If we were in the middle of a Collect_Keys and an error occurs, then
     // the binding lookup table has entries in it that need to be zeroed out.
     // We can tell if that's necessary by whether there is anything
@@ -203,6 +220,8 @@ REBOOL Trapped_Helper_Halted(struct Reb_State *s)
         );
     }
 
+    Drop_Arena(s->arena_mark);
+
     SET_SERIES_LEN(GC_Guarded, s->guarded_len);
     TG_Frame_Stack = s->frame;
     TERM_SEQUENCE_LEN(UNI_BUF, s->uni_buf_len);
@@ -471,6 +490,8 @@ void Set_Location_Of_Error(
         if (Is_Function_Frame_Fulfilling(f))
             continue;
 
+        Push_Compiled_Labels(f); // IF, LOOP... run inline by a compiled body
+
         DS_PUSH_TRASH;
         Get_Frame_Label_Or_Blank(DS_TOP, f);
     }
@@ -482,26 +503,34 @@ void Set_Location_Of_Error(
     Init_Near_For_Frame(&vars->nearest, where);
 
     // Try to fill in the file and line information of the error from the
-    // stack, looking for arrays with SERIES_FLAG_FILE_LINE.
+    // stack, looking for arrays with SERIES_FLAG_FILE_LINE.  The frames of a
+    // compiled body go by where it is in the body, see Get_Compiled_Position()
     //
+    REBARR *array = NULL;
     f = where;
     for (; f != NULL; f = f->prior) {
-        if (FRM_IS_VALIST(f)) {
-            //
-            // !!! We currently skip any calls from C (e.g. rebDo()) and look
-            // for calls from Rebol files for the file and line.  However,
-            // rebDo() might someday supply its C code __FILE__ and __LINE__,
-            // which might be interesting to put in the error instead.
-            //
-            continue;
+        REBCNT index;
+        REBSPC *specifier;
+        if (NOT(Get_Compiled_Position(&array, &index, &specifier, f))) {
+            if (FRM_IS_VALIST(f)) {
+                //
+                // !!! We currently skip any calls from C (e.g. rebDo()) and
+                // look for calls from Rebol files for the file and line.
+                // However, rebDo() might someday supply its C code __FILE__
+                // and __LINE__, which might be interesting to put in the
+                // error instead.
+                //
+                continue;
+            }
+            array = f->source.array;
         }
-        if (NOT_SER_FLAG(f->source.array, SERIES_FLAG_FILE_LINE))
+        if (NOT_SER_FLAG(array, SERIES_FLAG_FILE_LINE))
             continue;
         break;
     }
     if (f != NULL) {
-        REBSTR *file = LINK(f->source.array).file;
-        REBUPT line = MISC(f->source.array).line;
+        REBSTR *file = LINK(array).file;
+        REBUPT line = MISC(array).line;
 
         REBSYM file_sym = STR_SYMBOL(file);
         if (file_sym != SYM___ANONYMOUS__)
@@ -50,6 +50,7 @@
 //
 
 #include "sys-core.h"
+#include "sys-int-funcs.h"
 
 
 #if !defined(NDEBUG)
@@ -89,11 +90,247 @@
 // overridden e.g. by TRACE, which would like to preface the apply by dumping
 // the frame and postfix it by showing the evaluative result.
 //
+// Functions with FUNC_FLAG_TYPED_ENTRIES may run an entry point specialized
+// for the types of their first two arguments instead of the dispatcher.
+//
 REB_R Apply_Core(REBFRM * const f) {
+    if (GET_VAL_FLAG(FUNC_VALUE(f->phase), FUNC_FLAG_TYPED_ENTRIES)) {
+        REBNAT entry = Find_Typed_Entry(
+            f->phase,
+            VAL_TYPE(FRM_ARG(f, 1)),
+            VAL_TYPE(FRM_ARG(f, 2))
+        );
+        if (entry != NULL)
+            return entry(f);
+    }
+
     return FUNC_DISPATCHER(f->phase)(f);
 }
 
 
+// An argument that is a single inert value, or a WORD! that looks up to one,
+// is the whole of its expression...unless a WORD! comes after it, because
+// only a WORD! can dispatch enfix (or an "invisible" like COMMENT).  Such
+// arguments are taken here without pushing a subframe and recursing into
+// Do_Core().  If a word looks up to a function, its fetch is left in
+// f->gotten for the subframe to reuse.
+//
+// This isn't done when tracing, so TRACE still shows every evaluation.
+//
+static inline REBOOL Quick_Arg_In_Frame(REBVAL *arg, REBFRM *f) {
+    if (FRM_IS_VALIST(f) || PG_Do != &Do_Core)
+        return FALSE;
+
+    if (NOT_END(f->source.pending) && IS_WORD(f->source.pending))
+        return FALSE; // could be enfix, taking this argument as its left
+
+    enum Reb_Kind kind = VAL_TYPE(f->value);
+
+    if (kind == REB_WORD) {
+        if (f->gotten == END)
+            f->gotten = Get_Opt_Var_Else_End(f->value, f->specifier);
+
+        enum Reb_Kind gotten_kind = VAL_TYPE_OR_0(f->gotten); // END is REB_0
+        if (
+            gotten_kind == REB_0
+            || gotten_kind == REB_FUNCTION
+            || gotten_kind == REB_MAX_VOID
+        ){
+            return FALSE; // let the subframe run it, or raise the error
+        }
+
+        Move_Value(arg, f->gotten); // no VALUE_FLAG_UNEVALUATED
+    }
+    else if (
+        IS_KIND_INERT(kind)
+        && kind != REB_BAR
+        && kind != REB_LIT_BAR
+        && kind != REB_MAX_VOID
+    ){
+        Derelativize(arg, f->value, f->specifier);
+        SET_VAL_FLAG(arg, VALUE_FLAG_UNEVALUATED);
+    }
+    else
+        return FALSE;
+
+    f->gotten = END;
+    Fetch_Next_In_Frame(f);
+    return TRUE;
+}
+
+
+// Enfix math and comparison on two INTEGER!s (or math on two DECIMAL!s) is
+// the bulk of what loop bodies and conditions do.  The operator is known by
+// its dispatcher--so e.g. a TIGHTEN-ed ADD under any name is recognized, but
+// not a HIJACK-ed or ADAPT-ed one--and run without pushing a frame for it.
+// Anything else, including overflow, is left to the full call.
+//
+// It is safe for `out` to be the same cell as `left`.
+//
+static inline REBOOL Quick_Binary_Op_Core(
+    REBVAL *out,
+    REBFUN *fun,
+    const REBVAL *left,
+    const RELVAL *right
+){
+    if (FUNC_FACADE_NUM_RELEASE_PARAMS(fun) != 2 || FUNC_EXEMPLAR(fun) != NULL)
+        return FALSE;
+
+    REBVAL *param1 = FUNC_FACADE_HEAD(fun);
+    REBVAL *param2 = param1 + 1;
+
+    enum Reb_Kind kind = VAL_TYPE(left);
+    if (
+        (kind != REB_INTEGER && kind != REB_DECIMAL)
+        || VAL_TYPE_OR_0(right) != kind // END is REB_0
+        || NOT(TYPE_CHECK(param1, kind))
+        || NOT(TYPE_CHECK(param2, kind))
+    ){
+        return FALSE;
+    }
+
+    REBNAT dispatcher = FUNC_DISPATCHER(fun);
+    if (dispatcher == &Action_Dispatcher) {
+        REBSYM sym = VAL_WORD_SYM(FUNC_BODY(fun));
+
+        if (kind == REB_INTEGER) {
+            REBI64 n1 = VAL_INT64(left);
+            REBI64 n2 = VAL_INT64(right);
+            REBI64 n;
+            switch (sym) {
+            case SYM_ADD:
+                if (REB_I64_ADD_OF(n1, n2, &n))
+                    return FALSE;
+                break;
+
+            case SYM_SUBTRACT:
+                if (REB_I64_SUB_OF(n1, n2, &n))
+                    return FALSE;
+                break;
+
+            case SYM_MULTIPLY:
+                if (REB_I64_MUL_OF(n1, n2, &n))
+                    return FALSE;
+                break;
+
+            default:
+                return FALSE;
+            }
+            Init_Integer(out, n);
+        }
+        else {
+            REBDEC d1 = VAL_DECIMAL(left);
+            REBDEC d2 = VAL_DECIMAL(right);
+            REBDEC d;
+            switch (sym) {
+            case SYM_ADD:
+                d = d1 + d2;
+                break;
+
+            case SYM_SUBTRACT:
+                d = d1 - d2;
+                break;
+
+            case SYM_MULTIPLY:
+                d = d1 * d2;
+                break;
+
+            default:
+                return FALSE;
+            }
+            if (!FINITE(d))
+                return FALSE;
+            Init_Decimal(out, d);
+        }
+    }
+    else {
+        if (kind != REB_INTEGER)
+            return FALSE; // DECIMAL! equality has a tolerance, see Eq_Decimal
+
+        REBI64 n1 = VAL_INT64(left);
+        REBI64 n2 = VAL_INT64(right);
+        REBOOL logic;
+        if (dispatcher == &N_equal_q)
+            logic = LOGICAL(n1 == n2);
+        else if (dispatcher == &N_not_equal_q)
+            logic = LOGICAL(n1 != n2);
+        else if (dispatcher == &N_lesser_q)
+            logic = LOGICAL(n1 < n2);
+        else if (dispatcher == &N_lesser_or_equal_q)
+            logic = LOGICAL(n1 <= n2);
+        else if (dispatcher == &N_greater_q)
+            logic = LOGICAL(n1 > n2);
+        else if (dispatcher == &N_greater_or_equal_q)
+            logic = LOGICAL(n1 >= n2);
+        else
+            return FALSE;
+        Init_Logic(out, logic);
+    }
+
+    return TRUE;
+}
+
+
+//
+//  Quick_Binary_Op: C
+//
+// Exported form of Quick_Binary_Op_Core(), for the bytecode tier to run the
+// same enfix operations that Quick_Enfix_In_Frame() does.  Returns FALSE if
+// `fun` with these arguments isn't a case handled without a frame.
+//
+REBOOL Quick_Binary_Op(
+    REBVAL *out,
+    REBFUN *fun,
+    const REBVAL *left,
+    const RELVAL *right
+){
+    return Quick_Binary_Op_Core(out, fun, left, right);
+}
+
+
+// The evaluator's use of Quick_Binary_Op_Core() is for an enfix operator
+// found by lookahead, with f->out as its left hand side.  The right hand side
+// must be an inert value or a WORD! that looks up to one.  If the operator's
+// right parameter is normal and not #tight, then a WORD! after it could
+// continue its expression, so that isn't handled here.
+//
+// The frame is left at whatever follows the right hand side, with the result
+// in f->out.
+//
+static inline REBOOL Quick_Enfix_In_Frame(REBFRM *f) {
+    if (FRM_IS_VALIST(f) || PG_Do != &Do_Core || PG_Apply != &Apply_Core)
+        return FALSE;
+
+    const RELVAL *right = f->source.pending;
+    if (IS_END(right) || GET_VAL_FLAG(right, VALUE_FLAG_EVAL_FLIP))
+        return FALSE;
+
+    REBFUN *fun = VAL_FUNC(f->gotten);
+    if (FUNC_FACADE_NUM_RELEASE_PARAMS(fun) != 2)
+        return FALSE;
+
+    REBVAL *param2 = FUNC_FACADE_HEAD(fun) + 1;
+    if (VAL_PARAM_CLASS(param2) == PARAM_CLASS_NORMAL) {
+        if (NOT_END(right + 1) && IS_WORD(right + 1))
+            return FALSE; // could be enfix, taking the right side as its left
+    }
+    else if (VAL_PARAM_CLASS(param2) != PARAM_CLASS_TIGHT)
+        return FALSE;
+
+    const RELVAL *arg = right;
+    if (IS_WORD(right))
+        arg = Get_Opt_Var_Else_End(right, f->specifier);
+
+    if (NOT(Quick_Binary_Op_Core(f->out, fun, f->out, arg)))
+        return FALSE;
+
+    f->gotten = END;
+    Fetch_Next_In_Frame(f); // to the right hand side...
+    Fetch_Next_In_Frame(f); // ...and past it
+    return TRUE;
+}
+
+
 static inline REBOOL Start_New_Expression_Throws(REBFRM *f) {
 #if !defined(NDEBUG)
     assert(IS_UNREADABLE_IF_DEBUG(f->out) || IS_END(f->out));
@@ -1219,6 +1456,9 @@ reevaluate:;
                     flags |= DO_FLAG_NEUTRAL;
 
                 Prep_Stack_Cell(f->arg);
+                if (NOT(neutral) && Quick_Arg_In_Frame(f->arg, f))
+                    break;
+
                 if (Do_Next_In_Subframe_Throws(f->arg, f, flags)) {
                     Move_Value(f->out, f->arg);
                     Abort_Function(f);
@@ -1241,6 +1481,9 @@ reevaluate:;
                     flags |= DO_FLAG_NEUTRAL;
 
                 Prep_Stack_Cell(f->arg);
+                if (NOT(neutral) && Quick_Arg_In_Frame(f->arg, f))
+                    break;
+
                 if (Do_Next_In_Subframe_Throws(f->arg, f, flags)) {
                     Move_Value(f->out, f->arg);
                     Abort_Function(f);
@@ -2587,7 +2830,14 @@ post_switch:;
     // This is a case for an evaluative lookback argument we don't want to
     // defer, e.g. a #tight argument or a normal one which is not being
     // requested in the context of parameter fulfillment.  We want to reuse
-    // the f->out value and get it into the new function's frame.
+    // the f->out value and get it into the new function's frame...unless
+    // it's simple enough to not need a frame at all.
+
+    if (NOT(neutral) && evaluating && Quick_Enfix_In_Frame(f)) {
+        if (FRM_AT_END(f))
+            goto finished;
+        goto post_switch; // e.g. `x + 1 * 2` has more enfix to consider
+    }
 
     Push_Function(
         f,
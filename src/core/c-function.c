@@ -1767,6 +1767,101 @@ REBTYPE(Fail)
 }
 
 
+// A function may have entry points that are used instead of its dispatcher
+// when its first two arguments are of particular types, e.g. ADD on two
+// INTEGER!s can skip the Value_Dispatch[] and action switch() that generic
+// ADD goes through.  They are chosen by Apply_Core(), after the arguments
+// have been typechecked.
+//
+// Entries are looked up by the underlying function, so they are used by
+// e.g. a TIGHTEN of the function as well.  They are only good as long as the
+// dispatcher is still the one the function was registered with--so not for
+// an ADAPT or SPECIALIZE, or if it gets HIJACKed.
+//
+#define MAX_TYPED_ENTRIES 32
+
+struct Reb_Typed_Entry {
+    REBFUN *underlying;
+    REBNAT dispatcher;
+    enum Reb_Kind kind1;
+    enum Reb_Kind kind2;
+    REBNAT entry;
+};
+
+static struct Reb_Typed_Entry Typed_Entries[MAX_TYPED_ENTRIES];
+static REBCNT Num_Typed_Entries = 0;
+
+
+//
+//  Register_Typed_Entry: C
+//
+// Entries are registered during boot, before anything can copy the function
+// (e.g. to TIGHTEN it) so copies inherit FUNC_FLAG_TYPED_ENTRIES.
+//
+void Register_Typed_Entry(
+    REBFUN *fun,
+    enum Reb_Kind kind1,
+    enum Reb_Kind kind2,
+    REBNAT entry
+){
+    assert(FUNC_UNDERLYING(fun) == fun);
+    assert(FUNC_NUM_PARAMS(fun) >= 2);
+
+    if (Num_Typed_Entries == MAX_TYPED_ENTRIES)
+        panic ("Too many typed entries, increase MAX_TYPED_ENTRIES");
+
+    struct Reb_Typed_Entry *e = &Typed_Entries[Num_Typed_Entries++];
+    e->underlying = fun;
+    e->dispatcher = FUNC_DISPATCHER(fun);
+    e->kind1 = kind1;
+    e->kind2 = kind2;
+    e->entry = entry;
+
+    SET_VAL_FLAG(FUNC_VALUE(fun), FUNC_FLAG_TYPED_ENTRIES);
+}
+
+
+//
+//  Find_Typed_Entry: C
+//
+// Returns NULL if there's no entry for the phase with these argument kinds.
+//
+REBNAT Find_Typed_Entry(REBFUN *phase, enum Reb_Kind kind1, enum Reb_Kind kind2)
+{
+    REBFUN *underlying = FUNC_UNDERLYING(phase);
+    REBNAT dispatcher = FUNC_DISPATCHER(phase);
+
+    struct Reb_Typed_Entry *e = Typed_Entries;
+    struct Reb_Typed_Entry *tail = Typed_Entries + Num_Typed_Entries;
+    for (; e != tail; ++e) {
+        if (
+            e->underlying == underlying
+            && e->kind1 == kind1
+            && e->kind2 == kind2
+            && e->dispatcher == dispatcher
+        ){
+            return e->entry;
+        }
+    }
+    return NULL;
+}
+
+
+//
+//  Lib_Function: C
+//
+// Function a lib word was set to during boot, e.g. an action like ADD.
+//
+REBFUN *Lib_Function(REBSYM sym)
+{
+    REBCNT n = Find_Canon_In_Context(Lib_Context, Canon(sym), FALSE);
+    if (n == 0 || NOT(IS_FUNCTION(CTX_VAR(Lib_Context, n))))
+        panic (Canon(sym));
+
+    return VAL_FUNC(CTX_VAR(Lib_Context, n));
+}
+
+
 //
 //  Action_Dispatcher: C
 //
@@ -1890,17 +1985,11 @@ REB_R Typeset_Checker_Dispatcher(REBFRM *f)
 //
 REB_R Unchecked_Dispatcher(REBFRM *f)
 {
-    RELVAL *body = FUNC_BODY(f->phase);
-    assert(IS_BLOCK(body) && IS_RELATIVE(body) && VAL_INDEX(body) == 0);
-
-    if (Do_At_Throws(
-        f->out,
-        VAL_ARRAY(body),
-        0, // VAL_INDEX(body) asserted 0 above
-        AS_SPECIFIER(f)
-    )){
+    if (Do_Body_Throws(f)) // may run compiled form, see %c-bytecode.c
         return R_OUT_IS_THROWN;
-    }
+
+    if (IS_END(f->out))
+        return R_REDO_CHECKED; // tail call switched f->phase
 
     return R_OUT;
 }
@@ -1915,17 +2004,11 @@ REB_R Unchecked_Dispatcher(REBFRM *f)
 //
 REB_R Voider_Dispatcher(REBFRM *f)
 {
-    RELVAL *body = FUNC_BODY(f->phase);
-    assert(IS_BLOCK(body) && IS_RELATIVE(body) && VAL_INDEX(body) == 0);
-
-    if (Do_At_Throws(
-        f->out,
-        VAL_ARRAY(body),
-        0, // VAL_INDEX(body) asserted 0 above
-        AS_SPECIFIER(f)
-    )){
+    if (Do_Body_Throws(f))
         return R_OUT_IS_THROWN;
-    }
+
+    if (IS_END(f->out))
+        return R_REDO_CHECKED; // tail call switched f->phase
 
     return R_VOID;
 }
@@ -1940,17 +2023,11 @@ REB_R Voider_Dispatcher(REBFRM *f)
 //
 REB_R Returner_Dispatcher(REBFRM *f)
 {
-    RELVAL *body = FUNC_BODY(f->phase);
-    assert(IS_BLOCK(body) && IS_RELATIVE(body) && VAL_INDEX(body) == 0);
-
-    if (Do_At_Throws(
-        f->out,
-        VAL_ARRAY(body),
-        0, // VAL_INDEX(body) asserted 0 above
-        AS_SPECIFIER(f)
-    )){
+    if (Do_Body_Throws(f))
         return R_OUT_IS_THROWN;
-    }
+
+    if (IS_END(f->out))
+        return R_REDO_CHECKED; // tail call switched f->phase
 
     REBVAL *typeset = FUNC_PARAM(f->phase, FUNC_NUM_PARAMS(f->phase));
     assert(VAL_PARAM_SYM(typeset) == SYM_RETURN);
@@ -110,6 +110,13 @@ REBOOL Do_Signals_Throws(REBVAL *out)
         CLR_SIGNAL(SIG_RECYCLE);
         Recycle();
     }
+    else if (GC_Sweeping && (saved_mask & SIG_RECYCLE))
+        Recycle(); // continues a sliced sweep (see RECYCLE/INCREMENTAL)
+
+    if (filtered_sigs & SIG_SAMPLE) {
+        CLR_SIGNAL(SIG_SAMPLE);
+        Sample_Stack();
+    }
 
 #ifdef NOT_USED_INVESTIGATE
     if (filtered_sigs & SIG_EVENT_PORT) {  // !!! Why not used?
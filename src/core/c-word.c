@@ -38,136 +38,57 @@
 #define WORD_TABLE_SIZE 1024  // initial size in words
 
 
-//
-// Prime numbers used for hash table sizes. Divide by 2 for
-// number of words that can be held in the symbol table.
-//
-static REBCNT const Primes[] =
-{
-    7,
-    13,
-    31,
-    61,
-    127,
-    251,
-    509,
-    1021,
-    2039,
-    4093,
-    8191,
-    16381,
-    32749,
-    65521,
-    131071,
-    262139,
-    524287,
-    1048573,
-    2097143,
-    4194301,
-    8388593,
-    16777213,
-    33554393,
-    67108859,
-    134217689,
-    268435399,
-    536870909,
-    1073741789,
-    2147483647,
-    0xFFFFFFFB, // 4294967291 = 2^32 - 5 (C89)
-    0
-// see https://primes.utm.edu/lists/2small/0bit.html
+// Each slot of PG_Canons_By_Hash holds a canon spelling along with the
+// Hash_Word() of it.  A probe only looks at the spelling in a slot if the
+// hashes are the same, so it doesn't touch the memory of every other word
+// in the collision chain.  Growing the table doesn't need to look at any
+// spellings at all, it just moves the slots.
+//
+struct Reb_Canon_Slot {
+    REBSTR *canon; // NULL if the slot is empty
+    REBCNT hash;
 };
 
 
-//
-//  Get_Hash_Prime: C
-//
-// Given a size, return a prime number that is larger.
-//
-REBINT Get_Hash_Prime(REBCNT size)
-{
-    REBINT n;
-
-    for (n = 0; Primes[n] && size > Primes[n]; n++);
-
-    if (!Primes[n]) return 0;
-
-    return Primes[n];
-}
-
-
-// Removals from linear probing lists can be complex, because the same
-// overflow slot may be visited through different initial hashes:
-//
-// http://stackoverflow.com/a/279812/211160
-//
-// Since it's not enough to simply NULL out the spot when an interned string
-// is GC'd, a special pointer signaling "deletedness" is used.  It does not
-// cause a linear probe to terminate, but it is reused on insertions.
-//
-static REBSTR PG_Deleted_Canon;
-#define DELETED_CANON &PG_Deleted_Canon
-
-
 //
 //  Expand_Word_Table: C
 //
-// Expand the hash table part of the word_table by allocating
-// the next larger table size and rehashing all the words of
-// the current table.  Free the old hash array.
+// Double the size of the table of canons, moving the slots of the current
+// table to their places in the new one.
 //
 static void Expand_Word_Table(void)
 {
-    // The only full list of canon words available is the old hash table.
-    // Hold onto it while creating the new hash table.
-
     REBCNT old_size = SER_LEN(PG_Canons_By_Hash);
-    REBSTR* *old_canons_by_hash = SER_HEAD(REBSER*, PG_Canons_By_Hash);
+    struct Reb_Canon_Slot *old_slots
+        = SER_HEAD(struct Reb_Canon_Slot, PG_Canons_By_Hash);
 
-    REBCNT new_size = Get_Hash_Prime(old_size + 1);
-    if (new_size == 0) {
+    if (old_size >= (1u << 30)) {
         DECLARE_LOCAL (temp);
         Init_Integer(temp, old_size + 1);
         fail (Error_Size_Limit_Raw(temp));
     }
+    REBCNT new_size = old_size * 2;
 
-    assert(SER_WIDE(PG_Canons_By_Hash) == sizeof(REBSTR*));
+    assert(SER_WIDE(PG_Canons_By_Hash) == sizeof(struct Reb_Canon_Slot));
 
     REBSER *ser = Make_Series_Core(
-        new_size, sizeof(REBSTR*), SERIES_FLAG_POWER_OF_2
+        new_size, sizeof(struct Reb_Canon_Slot), SERIES_FLAG_POWER_OF_2
     );
     Clear_Series(ser);
     SET_SERIES_LEN(ser, new_size);
 
-    // Rehash all the symbols:
-
-    REBSTR **new_canons_by_hash = SER_HEAD(REBSER*, ser);
+    struct Reb_Canon_Slot *new_slots = SER_HEAD(struct Reb_Canon_Slot, ser);
+    REBCNT mask = new_size - 1;
 
     REBCNT n;
     for (n = 0; n < old_size; ++n) {
-        REBSTR *canon = old_canons_by_hash[n];
-
-        if (canon == NULL) continue;
-
-        if (canon == DELETED_CANON) { // clean out any deleted canon entries
-            --PG_Num_Canon_Slots_In_Use;
-        #if !defined(NDEBUG)
-            --PG_Num_Canon_Deleteds; // keep track for shutdown assert
-        #endif
+        if (old_slots[n].canon == NULL)
             continue;
-        }
 
-        REBINT hash = Hash_Word(STR_HEAD(canon), STR_NUM_BYTES(canon));
-        REBINT skip = (hash & 0x0000FFFF) % new_size;
-        if (skip == 0) skip = 1;
-        hash = (hash & 0x00FFFF00) % new_size;
-
-        while (new_canons_by_hash[hash] != NULL) {
-            hash += skip;
-            if (hash >= cast(REBINT, new_size))
-                hash -= new_size;
-        }
-        new_canons_by_hash[hash] = canon;
+        REBCNT i = old_slots[n].hash & mask;
+        while (new_slots[i].canon != NULL)
+            i = (i + 1) & mask;
+        new_slots[i] = old_slots[n];
     }
 
     Free_Series(PG_Canons_By_Hash);
@@ -205,59 +126,52 @@ REBSTR *Intern_UTF8_Managed(const REBYTE *utf8, REBCNT len)
     // the table is always checked for expansion needs *before* the search.)
     //
     REBCNT size = SER_LEN(PG_Canons_By_Hash);
-    if (PG_Num_Canon_Slots_In_Use > size / 2) {
+    if (PG_Num_Canon_Slots_In_Use >= size / 2) {
         Expand_Word_Table();
         size = SER_LEN(PG_Canons_By_Hash); // got larger
     }
 
-    REBSTR* *canons_by_hash = SER_HEAD(REBSER*, PG_Canons_By_Hash);
+    struct Reb_Canon_Slot *slots
+        = SER_HEAD(struct Reb_Canon_Slot, PG_Canons_By_Hash);
+    REBCNT mask = size - 1;
 
-    // Calculate the starting hash slot to try--and the amount to skip to by
-    // each time a slot is found that is occupied by a non-match.
-    //
     REBCNT hash = Hash_Word(utf8, len);
-    REBCNT skip = (hash & 0x0000FFFF) % size;
-    if (skip == 0)
-        skip = 1;
-    hash = (hash & 0x00FFFF00) % size;
+    REBCNT i = hash & mask;
 
-    REBSTR **deleted_slot = NULL;
-
-    // The hash table only indexes the canon form of each spelling.  So when
-    // testing a slot to see if it's a match (or a collision that needs to
-    // be skipped to try again) the search uses a comparison that is
-    // case-insensitive...and returns a value > 0 for a match.
-    //
-    // However, the result also indicates whether it was an *exact* match, by
-    // returning 0 if it is.
+    // The hash table only indexes the canon form of each spelling.  Since
+    // Hash_Word() is case-insensitive, all the synonyms of a canon have its
+    // hash--so a slot with any other hash can't be a match, and is skipped
+    // without looking at its spelling.
     //
     REBSTR* canon;
-    while ((canon = canons_by_hash[hash]) != NULL) {
-        if (canon == DELETED_CANON) {
-            deleted_slot = &canons_by_hash[hash];
-            hash += skip;
-            if (hash >= size) hash -= size;
+    for (; (canon = slots[i].canon) != NULL; i = (i + 1) & mask) {
+        if (slots[i].hash != hash)
             continue;
-        }
 
         assert(GET_SER_INFO(canon, STRING_INFO_CANON));
 
+        // Most of the time a word being interned has been seen before, with
+        // the same casing as the canon.  Check for that with a plain memcmp()
+        // before doing the case-insensitive UTF-8 comparison.
+        //
+        if (
+            STR_NUM_BYTES(canon) == len
+            && 0 == memcmp(STR_HEAD(canon), utf8, len)
+        ){
+            if (GC_Sweeping)
+                Mark_Node_Black(NOD(canon)); // may be unreachable, unswept
+            return canon;
+        }
+
         // Compare_UTF8 returns 0 when the spelling is a case-sensitive match,
-        // and is the exact interning to return.
+        // which the memcmp() would have found.  Less than zero means that
+        // the canon value in the slot isn't the same at all (the hashes
+        // collided), so keep looking.
         //
         REBINT cmp = Compare_UTF8(STR_HEAD(canon), utf8, len);
-        if (cmp == 0) return canon;
-
-        if (cmp < 0) {
-            //
-            // Compare_UTF8 returns less than zero when the canon value in the
-            // slot isn't the same at all.  Since it's not a match, skip ahead
-            // to the next candidate slot--wrapping around if necessary
-            //
-            hash += skip;
-            if (hash >= size) hash -= size;
+        assert(cmp != 0);
+        if (cmp < 0)
             continue;
-        }
 
         // The > 0 result means that the canon word that was found is an
         // alternate casing ("synonym") for the string we're interning.  The
@@ -271,13 +185,15 @@ REBSTR *Intern_UTF8_Managed(const REBYTE *utf8, REBCNT len)
 
             // Exact match for a synonym also means no new allocation needed.
             //
-            cmp = Compare_UTF8(STR_HEAD(synonym), utf8, len);
-            if (cmp == 0) return synonym;
+            if (
+                STR_NUM_BYTES(synonym) == len
+                && 0 == memcmp(STR_HEAD(synonym), utf8, len)
+            ){
+                if (GC_Sweeping)
+                    Mark_Node_Black(NOD(synonym));
+                return synonym;
+            }
 
-            // Comparison should at least be a synonym, if in this list.
-            // Keep checking for an exact match until a cycle is found.
-            //
-            assert(cmp > 0);
             synonym = LINK(synonym).synonym;
         }
 
@@ -319,19 +235,11 @@ new_interning: ; // semicolon needed for statement
     if (canon == NULL) {
         //
         // There was no canon symbol found, so this interning will be canon.
-        // Add it to the hash table and mark it, reuse deleted slot (if any)
+        // Add it to the hash table in the empty slot the search ended on.
         //
-        if (deleted_slot) {
-            *deleted_slot = intern; // slot "usage" count stays constant
-
-        #if !defined(NDEBUG)
-            --PG_Num_Canon_Deleteds;
-        #endif
-        }
-        else {
-            canons_by_hash[hash] = intern;
-            ++PG_Num_Canon_Slots_In_Use;
-        }
+        slots[i].canon = intern;
+        slots[i].hash = hash;
+        ++PG_Num_Canon_Slots_In_Use;
 
         SET_SER_INFO(intern, STRING_INFO_CANON);
 
@@ -412,23 +320,18 @@ void GC_Kill_Interning(REBSTR *intern)
     assert(MISC(intern).bind_index.low == 0);
 
     REBCNT size = SER_LEN(PG_Canons_By_Hash);
-    REBSTR* *canons_by_hash = SER_HEAD(REBSER*, PG_Canons_By_Hash);
-    assert(canons_by_hash != NULL);
+    struct Reb_Canon_Slot *slots
+        = SER_HEAD(struct Reb_Canon_Slot, PG_Canons_By_Hash);
+    REBCNT mask = size - 1;
 
     REBCNT len = STR_NUM_BYTES(intern);
     assert(len == LEN_BYTES(STR_HEAD(intern)));
 
-    REBCNT hash = Hash_Word(STR_HEAD(intern), len);
-    REBCNT skip = (hash & 0x0000FFFF) % size;
-    if (skip == 0) skip = 1;
-    hash = (hash & 0x00FFFF00) % size;
-
     // We *will* find the canon form in the hash table.
     //
-    while (canons_by_hash[hash] != intern) {
-        hash += skip;
-        if (hash >= size) hash -= size;
-    }
+    REBCNT i = cast(REBCNT, Hash_Word(STR_HEAD(intern), len)) & mask;
+    while (slots[i].canon != intern)
+        i = (i + 1) & mask;
 
     if (synonym != intern) {
         //
@@ -437,35 +340,42 @@ void GC_Kill_Interning(REBSTR *intern)
         // It should hash the same, and be able to take over the hash slot.
         //
     #ifdef SLOW_INTERN_HASH_DOUBLE_CHECK
-        assert(hash == Hash_Word(STR_HEAD(synonym)));
+        assert(
+            slots[i].hash
+            == cast(REBCNT, Hash_Word(STR_HEAD(synonym), STR_NUM_BYTES(synonym)))
+        );
     #endif
-        canons_by_hash[hash] = synonym;
+        slots[i].canon = synonym;
         SET_SER_INFO(synonym, STRING_INFO_CANON);
         MISC(synonym).bind_index.low = 0;
         MISC(synonym).bind_index.high = 0;
+
+        // Hashes of the old canon's pointer are stale now (see the keylist
+        // indexes in %c-context.c)
+        //
+        ++PG_Canon_Epoch;
     }
     else {
-        // This canon form must be removed from the hash table.  Ripple the
-        // collision slots back until a NULL is found, to reduce search times.
+        // This canon form must be removed from the hash table.  Rather than
+        // leave a "deleted" marker in the slot, entries after it in the
+        // collision chain are shifted back to fill the hole.  An entry can
+        // only move back if that doesn't put it before its home slot.
         //
-        REBCNT previous_hash = hash;
-        while (canons_by_hash[hash] != NULL) {
-            hash += skip;
-            if (hash >= size) hash -= size;
-            canons_by_hash[previous_hash] = canons_by_hash[hash];
+        REBCNT hole = i;
+        while (TRUE) {
+            i = (i + 1) & mask;
+            if (slots[i].canon == NULL)
+                break;
+
+            REBCNT home = slots[i].hash & mask;
+            if (((i - home) & mask) < ((i - hole) & mask))
+                continue; // home is after the hole, has to stay put
+
+            slots[hole] = slots[i];
+            hole = i;
         }
-
-        // Signal that the hash slot is "deleted" via a special pointer.
-        // See notes on DELETED_SLOT for why the final slot in the collision
-        // chain can't just be left NULL:
-        //
-        // http://stackoverflow.com/a/279812/211160
-        //
-        canons_by_hash[previous_hash] = DELETED_CANON;
-
-    #if !defined(NDEBUG)
-        ++PG_Num_Canon_Deleteds; // total use same (PG_Num_Canons_Or_Deleteds)
-    #endif
+        slots[hole].canon = NULL;
+        --PG_Num_Canon_Slots_In_Use;
     }
 }
 
@@ -515,13 +425,11 @@ REBINT Compare_Word(const RELVAL *s, const RELVAL *t, REBOOL strict)
 void Startup_Interning(void)
 {
     PG_Num_Canon_Slots_In_Use = 0;
-#if !defined(NDEBUG)
-    PG_Num_Canon_Deleteds = 0;
-#endif
+    PG_Canon_Epoch = 0;
 
-    // Start hash table out at a fixed size.  When collisions occur, it
-    // causes a skipping pattern that continues until it finds the desired
-    // slot.  The method is known as linear probing:
+    // Start hash table out at a fixed size.  When collisions occur, the
+    // search goes on to the next slot until it finds the desired one.  The
+    // method is known as linear probing:
     //
     // https://en.wikipedia.org/wiki/Linear_probing
     //
@@ -529,16 +437,18 @@ void Startup_Interning(void)
     // for it to uniquely be able to locate each symbol pointer.  But to
     // reduce long probing chains, it should be significantly larger than that.
     // R3-Alpha used a heuristic of 4 times as big as the number of words.
+    //
+    // The size must be a power of 2, so the hash can be masked to a slot.
 
     REBCNT n;
 #if defined(NDEBUG)
-    n = Get_Hash_Prime(WORD_TABLE_SIZE * 4); // extra reduces rehashing
+    n = WORD_TABLE_SIZE * 4; // extra reduces rehashing
 #else
     n = 1; // forces exercise of rehashing logic in debug build
 #endif
 
     PG_Canons_By_Hash = Make_Series_Core(
-        n, sizeof(REBSTR*), SERIES_FLAG_POWER_OF_2
+        n, sizeof(struct Reb_Canon_Slot), SERIES_FLAG_POWER_OF_2
     );
     Clear_Series(PG_Canons_By_Hash); // all slots start at NULL
     SET_SERIES_LEN(PG_Canons_By_Hash, n);
@@ -636,6 +546,6 @@ void Shutdown_Symbols(void)
 //
 void Shutdown_Interning(void)
 {
-    assert(PG_Num_Canon_Slots_In_Use - PG_Num_Canon_Deleteds == 0);
+    assert(PG_Num_Canon_Slots_In_Use == 0);
     Free_Series(PG_Canons_By_Hash);
 }
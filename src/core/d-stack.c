@@ -100,12 +100,21 @@ REBVAL *Init_Near_For_Frame(RELVAL *out, REBFRM *f)
 {
     REBCNT dsp_start = DSP;
 
-    if (FRM_IS_VALIST(f)) {
-        //
-        // Traversing a C va_arg, so reify into a (truncated) array.
-        //
-        const REBOOL truncated = TRUE;
-        Reify_Va_To_Array_In_Frame(f, truncated);
+    REBARR *array;
+    REBCNT index;
+    REBSPC *specifier;
+    if (NOT(Get_Compiled_Position(&array, &index, &specifier, f))) {
+        if (FRM_IS_VALIST(f)) {
+            //
+            // Traversing a C va_arg, so reify into a (truncated) array.
+            //
+            const REBOOL truncated = TRUE;
+            Reify_Va_To_Array_In_Frame(f, truncated);
+        }
+
+        array = FRM_ARRAY(f);
+        index = FRM_INDEX(f);
+        specifier = f->specifier;
     }
 
     // Get at most 6 values out of the array.  Ideally 3 before and after
@@ -123,7 +132,7 @@ REBVAL *Init_Near_For_Frame(RELVAL *out, REBFRM *f)
     }
     */
 
-    REBINT start = FRM_INDEX(f) - 3;
+    REBINT start = index - 3;
     if (start > 0) {
         DS_PUSH_TRASH;
         Init_Word(DS_TOP, Canon(SYM_ELLIPSIS));
@@ -132,7 +141,7 @@ REBVAL *Init_Near_For_Frame(RELVAL *out, REBFRM *f)
         start = 0;
 
     REBCNT count = 0;
-    RELVAL *item = ARR_AT(FRM_ARRAY(f), start);
+    RELVAL *item = ARR_AT(array, start);
     for (; NOT_END(item) && count < 6; ++item, ++count) {
         DS_PUSH_TRASH;
         if (IS_VOID(item)) {
@@ -145,11 +154,11 @@ REBVAL *Init_Near_For_Frame(RELVAL *out, REBFRM *f)
             // for display purposes and is "lossy" (as evidenced by the ...)
             // substitute a placeholder to avoid crashing the GC.
             //
-            assert(GET_SER_FLAG(FRM_ARRAY(f), ARRAY_FLAG_VOIDS_LEGAL));
+            assert(GET_SER_FLAG(array, ARRAY_FLAG_VOIDS_LEGAL));
             Init_Word(DS_TOP, Canon(SYM___VOID__));
         }
         else
-            Derelativize(DS_TOP, item, f->specifier);
+            Derelativize(DS_TOP, item, specifier);
 
         if (count == 0) {
             //
@@ -159,7 +168,7 @@ REBVAL *Init_Near_For_Frame(RELVAL *out, REBFRM *f)
             CLEAR_VAL_FLAG(DS_TOP, VALUE_FLAG_LINE);
         }
 
-        if (count == FRM_INDEX(f) - start - 1) {
+        if (count == index - start - 1) {
             //
             // Leave a marker at the point of the error, currently `~~`.
             // (Formerly it was ?? but that is now being actually used).
@@ -34,6 +34,11 @@
 
 #include "sys-core.h"
 
+#ifdef HAS_POSIX_SIGNAL
+    #include <signal.h>
+    #include <sys/time.h>
+#endif
+
 
 //
 //  stats: native [
@@ -48,6 +53,8 @@
 //          "High resolution time difference from start"
 //      /evals
 //          "Number of values evaluated by interpreter"
+//      /gc
+//          "Pause times and telemetry of recent recycles"
 //      /dump-series
 //          "Dump all series in pool"
 //      pool-id [integer!]
@@ -70,6 +77,11 @@ REBNATIVE(stats)
         return R_OUT;
     }
 
+    if (REF(gc)) {
+        Init_Block(D_OUT, Make_GC_Stats_Array());
+        return R_OUT;
+    }
+
 #ifdef NDEBUG
     UNUSED(REF(show));
     UNUSED(REF(profile));
@@ -81,33 +93,58 @@ REBNATIVE(stats)
     if (REF(profile)) {
         Move_Value(D_OUT, Get_System(SYS_STANDARD, STD_STATS));
         if (IS_OBJECT(D_OUT)) {
-            REBVAL *stats = VAL_CONTEXT_VAR(D_OUT, 1);
-
-            VAL_RESET_HEADER(stats, REB_TIME);
-            VAL_NANO(stats) = OS_DELTA_TIME(PG_Boot_Time) * 1000;
-            stats++;
-            Init_Integer(stats, Eval_Cycles + Eval_Dose - Eval_Count);
-            stats++;
-            Init_Integer(stats, 0); // no such thing as natives, only functions
-
-            stats++;
-            Init_Integer(stats, PG_Reb_Stats->Series_Made);
-            stats++;
-            Init_Integer(stats, PG_Reb_Stats->Series_Freed);
-            stats++;
-            Init_Integer(stats, PG_Reb_Stats->Series_Expanded);
-            stats++;
-            Init_Integer(stats, PG_Reb_Stats->Series_Memory);
-            stats++;
-            Init_Integer(stats, PG_Reb_Stats->Recycle_Series_Total);
-
-            stats++;
-            Init_Integer(stats, PG_Reb_Stats->Blocks);
-            stats++;
-            Init_Integer(stats, PG_Reb_Stats->Objects);
-
-            stats++;
-            Init_Integer(stats, PG_Reb_Stats->Recycle_Counter);
+            REBCTX *stats = VAL_CONTEXT(D_OUT);
+
+            REBVAL *timer = CTX_VAR(stats, STD_STATS_TIMER);
+            VAL_RESET_HEADER(timer, REB_TIME);
+            VAL_NANO(timer) = OS_DELTA_TIME(PG_Boot_Time) * 1000;
+            Init_Integer(
+                CTX_VAR(stats, STD_STATS_EVALS),
+                Eval_Cycles + Eval_Dose - Eval_Count
+            );
+
+            // no such thing as natives, only functions
+            //
+            Init_Integer(CTX_VAR(stats, STD_STATS_EVAL_NATIVES), 0);
+
+            Init_Integer(
+                CTX_VAR(stats, STD_STATS_SERIES_MADE),
+                PG_Reb_Stats->Series_Made
+            );
+            Init_Integer(
+                CTX_VAR(stats, STD_STATS_SERIES_FREED),
+                PG_Reb_Stats->Series_Freed
+            );
+            Init_Integer(
+                CTX_VAR(stats, STD_STATS_SERIES_EXPANDED),
+                PG_Reb_Stats->Series_Expanded
+            );
+            Init_Integer(
+                CTX_VAR(stats, STD_STATS_SERIES_BYTES),
+                PG_Reb_Stats->Series_Memory
+            );
+            Init_Integer(
+                CTX_VAR(stats, STD_STATS_SERIES_RECYCLED),
+                PG_Reb_Stats->Recycle_Series_Total
+            );
+
+            Init_Integer(
+                CTX_VAR(stats, STD_STATS_MADE_BLOCKS),
+                PG_Reb_Stats->Blocks
+            );
+            Init_Integer(
+                CTX_VAR(stats, STD_STATS_MADE_OBJECTS),
+                PG_Reb_Stats->Objects
+            );
+
+            Init_Integer(
+                CTX_VAR(stats, STD_STATS_RECYCLES),
+                PG_Reb_Stats->Recycle_Counter
+            );
+            Init_Integer(
+                CTX_VAR(stats, STD_STATS_SERIES_COMPACTED),
+                GC_Compacted
+            );
         }
 
         return R_OUT;
@@ -408,6 +445,278 @@ REBNATIVE(metrics)
 }
 
 
+//=//// SAMPLING PROFILER ////////////////////////////////////////////////=//
+//
+// Unlike METRICS, the profiler costs nothing per step.  PROFILE starts a
+// SIGPROF timer (which ticks with the CPU time the process uses), and the
+// handler only does SET_SIGNAL(SIG_SAMPLE)...just as Ctrl-C is handled.  So
+// it's the next evaluator step that calls Sample_Stack(), from inside of
+// Do_Signals_Throws(), where it's safe to walk the frames.  (A long-running
+// native thus delays its sample until the step after it returns.)
+//
+// A sample is the function frames outermost first, each one as its label
+// and the file and line it was called from, joined with `;`.  This is the
+// "collapsed stack" format flame graph tools read.  Samples are written as
+// text into a ring of fixed-size slots, so sampling makes no series and
+// holds no references the GC would have to know about.  Only the evaluator
+// writes or reads the ring, so it needs no locking.  If the ring fills up,
+// the oldest samples are overwritten.
+//
+
+#define PROFILE_RING_LEN 2048 // about 20 seconds at the default interval
+#define PROFILE_SAMPLE_SIZE 512 // bytes of collapsed stack text per sample
+#define PROFILE_FRAME_SIZE 128 // bytes for one frame of a sample
+
+static REBYTE *Profile_Ring = NULL; // NULL if the profiler is off
+static REBCNT Profile_Samples = 0; // latest is slot (n - 1) % LEN
+
+
+static REBCNT Form_Sample_Text(
+    REBYTE *buf,
+    REBCNT len,
+    const REBYTE *text
+){
+    for (; *text != '\0' && len < PROFILE_FRAME_SIZE; ++text)
+        buf[len++] = (*text == ';') ? '_' : *text; // ; separates frames
+    return len;
+}
+
+
+// The line is that of the array plus one for each new line marker up to the
+// expression that made the call.  So calls from different lines of the same
+// body are told apart, though it's only as exact as the array's own line
+// (the one errors report).
+//
+static REBCNT Form_Sample_Frame(REBYTE *buf, REBFRM *f)
+{
+    REBCNT len = Form_Sample_Text(
+        buf,
+        0,
+        f->opt_label != NULL
+            ? STR_HEAD(f->opt_label)
+            : cb_cast("anonymous")
+    );
+
+    if (FRM_IS_VALIST(f) || FRM_LINE(f) == 0)
+        return len;
+
+    REBSTR *file = FRM_FILE(f);
+    if (STR_SYMBOL(file) == SYM___ANONYMOUS__)
+        return len;
+
+    REBARR *array = FRM_ARRAY(f);
+    REBCNT index = FRM_EXPR_INDEX(f);
+    REBCNT line = FRM_LINE(f);
+    REBCNT n;
+    for (n = 0; n <= index && n < ARR_LEN(array); ++n) {
+        if (GET_VAL_FLAG(ARR_AT(array, n), VALUE_FLAG_LINE))
+            ++line;
+    }
+
+    REBYTE num[MAX_NUM_LEN + 1];
+    *Form_Int(num, line) = '\0';
+
+    len = Form_Sample_Text(buf, len, cb_cast(" ("));
+    len = Form_Sample_Text(buf, len, STR_HEAD(file));
+    len = Form_Sample_Text(buf, len, cb_cast(":"));
+    len = Form_Sample_Text(buf, len, num);
+    return Form_Sample_Text(buf, len, cb_cast(")"));
+}
+
+
+//
+//  Sample_Stack: C
+//
+// Called by Do_Signals_Throws() when the profiling timer has gone off.  The
+// sample is written from the back of its slot, innermost frame first, so if
+// the stack is too deep to fit it is the outermost frames that are left off.
+//
+void Sample_Stack(void)
+{
+    if (Profile_Ring == NULL)
+        return; // a tick that was pending when the profiler was turned off
+
+    REBYTE *slot = Profile_Ring
+        + (Profile_Samples % PROFILE_RING_LEN) * PROFILE_SAMPLE_SIZE;
+    ++Profile_Samples;
+
+    REBCNT pos = PROFILE_SAMPLE_SIZE - 1;
+    slot[pos] = '\0';
+
+    REBYTE frame[PROFILE_FRAME_SIZE];
+
+    REBFRM *f = FS_TOP;
+    for (; f != NULL; f = f->prior) {
+        if (NOT(Is_Function_Frame(f)))
+            continue;
+
+        REBCNT len = Form_Sample_Frame(frame, f);
+        REBCNT sep = (pos == PROFILE_SAMPLE_SIZE - 1) ? 0 : 1;
+        if (len + sep > pos)
+            break;
+
+        pos -= sep;
+        if (sep != 0)
+            slot[pos] = ';';
+        pos -= len;
+        memcpy(slot + pos, frame, len);
+    }
+
+    if (pos == PROFILE_SAMPLE_SIZE - 1)
+        strcpy(s_cast(slot), "(top)"); // no function running
+    else
+        memmove(slot, slot + pos, PROFILE_SAMPLE_SIZE - pos);
+}
+
+
+static int Compare_Samples(void *thunk, const void *v1, const void *v2)
+{
+    UNUSED(thunk);
+    return strcmp(
+        cs_cast(*cast(REBYTE* const*, v1)),
+        cs_cast(*cast(REBYTE* const*, v2))
+    );
+}
+
+
+// Gives one line per distinct stack with the number of times it was seen,
+// as `outer;inner 12`, and empties the ring.
+//
+static REBSER *Make_Collapsed_Stacks(void)
+{
+    REBSER *s = Make_Binary(0);
+
+    REBCNT num = MIN(Profile_Samples, PROFILE_RING_LEN);
+    if (num != 0) {
+        REBYTE **samples = ALLOC_N(REBYTE*, num);
+        REBCNT n;
+        for (n = 0; n < num; ++n)
+            samples[n] = Profile_Ring + n * PROFILE_SAMPLE_SIZE;
+        reb_qsort_r(samples, num, sizeof(REBYTE*), NULL, &Compare_Samples);
+
+        REBCNT count = 1;
+        for (n = 0; n < num; ++n, ++count) {
+            if (
+                n + 1 < num
+                && strcmp(cs_cast(samples[n]), cs_cast(samples[n + 1])) == 0
+            ){
+                continue;
+            }
+            s = Append_UTF8_May_Fail(s, samples[n], LEN_BYTES(samples[n]));
+            Append_Codepoint(s, ' ');
+            Append_Int(s, count);
+            Append_Codepoint(s, '\n');
+            count = 0;
+        }
+
+        FREE_N(REBYTE*, num, samples);
+    }
+
+    Profile_Samples = 0;
+    return s;
+}
+
+
+#ifdef HAS_POSIX_SIGNAL
+static void Handle_Profile_Signal(int sig)
+{
+    UNUSED(sig);
+    SET_SIGNAL(SIG_SAMPLE);
+}
+
+static void Set_Profile_Timer(REBI64 usec)
+{
+    struct sigaction action;
+    action.sa_handler = (usec == 0) ? SIG_IGN : &Handle_Profile_Signal;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART; // don't make blocking I/O give EINTR
+    sigaction(SIGPROF, &action, NULL);
+
+    struct itimerval timer;
+    timer.it_interval.tv_sec = usec / 1000000;
+    timer.it_interval.tv_usec = usec % 1000000;
+    timer.it_value = timer.it_interval;
+    setitimer(ITIMER_PROF, &timer, NULL);
+}
+#endif
+
+
+//
+//  profile: native [
+//
+//  {Sample the stack on a timer, for flame graphs of where time is spent.}
+//
+//      return: [string!]
+//          {Samples since the last call, as lines of `outer;inner count`}
+//      mode [logic!]
+//          {Whether sampling should be on or off.}
+//      /interval
+//          {CPU time between samples (default 10 milliseconds)}
+//      time [time!]
+//  ]
+//
+REBNATIVE(profile)
+{
+    INCLUDE_PARAMS_OF_PROFILE;
+
+    Check_Security(Canon(SYM_DEBUG), POL_READ, 0);
+
+#ifdef HAS_POSIX_SIGNAL
+    REBI64 usec = 10000;
+    if (REF(interval)) {
+        usec = VAL_NANO(ARG(time)) / 1000;
+        if (usec <= 0)
+            fail (Error_Invalid_Arg_Raw(ARG(time)));
+    }
+
+    Init_String(D_OUT, Make_Collapsed_Stacks());
+
+    if (VAL_LOGIC(ARG(mode))) {
+        //
+        // Setting the timer again would restart the interval, so a loop
+        // that called PROFILE more often than that would never get samples.
+        //
+        if (Profile_Ring == NULL) {
+            Profile_Ring = ALLOC_N(
+                REBYTE, PROFILE_RING_LEN * PROFILE_SAMPLE_SIZE
+            );
+            Set_Profile_Timer(usec);
+        }
+        else if (REF(interval))
+            Set_Profile_Timer(usec);
+    }
+    else
+        Shutdown_Profiler();
+
+    return R_OUT;
+#else
+    UNUSED(ARG(mode));
+    UNUSED(REF(interval));
+    UNUSED(ARG(time));
+    fail ("PROFILE needs a SIGPROF timer, which this platform doesn't have");
+#endif
+}
+
+
+//
+//  Shutdown_Profiler: C
+//
+// Stops the timer and frees the samples, if PROFILE was left on.
+//
+void Shutdown_Profiler(void)
+{
+    if (Profile_Ring == NULL)
+        return;
+
+#ifdef HAS_POSIX_SIGNAL
+    Set_Profile_Timer(0);
+#endif
+    FREE_N(REBYTE, PROFILE_RING_LEN * PROFILE_SAMPLE_SIZE, Profile_Ring);
+    Profile_Ring = NULL;
+    Profile_Samples = 0;
+}
+
+
 #ifdef INCLUDE_CALLGRIND_NATIVE
     #include <valgrind/callgrind.h>
 #endif
@@ -163,7 +163,10 @@ REBCNT Modify_String(
     if (action == SYM_APPEND || dst_idx > tail)
         dst_idx = tail;
 
-    // If the src_val is not a string, then we need to create a string:
+    // If the src_val is not a string, then we need to create a string.  The
+    // common cases of a CHAR! or a FORM go in the arena, see Push_Arena().
+
+    REBCNT arena = Push_Arena();
 
     REBCNT src_idx = 0;
     REBCNT src_len;
@@ -171,8 +174,10 @@ REBCNT Modify_String(
     REBOOL needs_free;
     if (flags & AM_BINARY_SERIES) {
         if (IS_INTEGER(src_val)) {
-            src_ser = Make_Series_Codepoint(Int8u(src_val));
-            needs_free = TRUE;
+            src_ser = Make_Arena_Series(2, 1);
+            *BIN_HEAD(src_ser) = cast(REBYTE, Int8u(src_val));
+            TERM_SEQUENCE_LEN(src_ser, 1);
+            needs_free = FALSE;
             limit = -1;
         }
         else if (IS_BLOCK(src_val)) {
@@ -187,12 +192,12 @@ REBCNT Modify_String(
             // bytes max. to be more compatible to UTF-16."  So depending on
             // which RFC you consider "the UTF-8", max size is either 4 or 6.
             //
-            src_ser = Make_Binary(6);
+            src_ser = Make_Arena_Series(6, 1);
             SET_SERIES_LEN(
                 src_ser,
                 Encode_UTF8_Char(BIN_HEAD(src_ser), VAL_CHAR(src_val))
             );
-            needs_free = TRUE;
+            needs_free = FALSE;
             limit = -1;
         }
         else if (ANY_STRING(src_val)) {
@@ -211,16 +216,22 @@ REBCNT Modify_String(
             fail (src_val);
     }
     else if (IS_CHAR(src_val)) {
-        src_ser = Make_Series_Codepoint(VAL_CHAR(src_val));
-        needs_free = TRUE;
+        REBUNI c = VAL_CHAR(src_val);
+        src_ser = Make_Arena_Series(2, c > 0xFF ? sizeof(REBUNI) : 1);
+        SET_ANY_CHAR(src_ser, 0, c);
+        TERM_SEQUENCE_LEN(src_ser, 1);
+        needs_free = FALSE;
     }
     else if (IS_BLOCK(src_val)) {
         src_ser = Form_Tight_Block(src_val);
         needs_free = TRUE;
     }
     else if (!ANY_STRING(src_val) || IS_TAG(src_val)) {
-        src_ser = Copy_Form_Value(src_val, 0);
-        needs_free = TRUE;
+        DECLARE_MOLD (mo);
+        Push_Mold(mo);
+        Form_Value(mo, src_val);
+        src_ser = Pop_Molded_String_Arena(mo);
+        needs_free = FALSE;
     }
     else {
         src_ser = NULL;
@@ -282,5 +293,7 @@ REBCNT Modify_String(
         Free_Series(src_ser);
     }
 
+    Drop_Arena(arena);
+
     return (action == SYM_APPEND) ? 0 : dst_idx;
 }
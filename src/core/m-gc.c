@@ -113,9 +113,56 @@ static void Mark_Devices_Deep(void);
     static REBOOL in_mark = FALSE; // needs to be per-GC thread
 #endif
 
+// Where a sliced sweep (see RECYCLE/INCREMENTAL) will pick up again
+//
+static REBSEG *sweep_seg = NULL;
+static REBCNT sweep_left = 0;
+static REBOOL in_sweep = FALSE; // e.g. a handle cleaner ran Make_Node()
+
+// Telemetry for the last GC_HISTORY_LEN pauses, see Make_GC_Stats_Array().
+// Times are in microseconds.  Each later slice of a sliced sweep is a pause
+// of its own, so it gets a SYM_SWEEP sample for what it swept.
+//
+#define GC_HISTORY_LEN 256
+
+struct Reb_GC_Sample {
+    REBSYM kind; // SYM_FULL, SYM_MINOR, SYM_SLICED or SYM_SWEEP
+    REBI64 pause; // whole Recycle_Nodes() call, including mark and sweep
+    REBI64 mark;
+    REBI64 sweep;
+    REBCNT live; // series pool nodes in use after the sweep
+    REBCNT freed; // what the recycle returns as its count
+    REBI64 reclaimed; // bytes of series nodes and data given back
+    REBINT ballast; // GC_Ballast when the recycle was triggered
+    REBCNT marked; // nodes marked (old ones rescanned by a minor count too)
+    REBCNT pools[SYSTEM_POOL]; // units given back to each pool
+};
+
+static struct Reb_GC_Sample gc_history[GC_HISTORY_LEN];
+static REBCNT gc_samples = 0; // latest is gc_history[(n - 1) % LEN]
+static REBCNT gc_recycles = 0; // samples not counting SYM_SWEEP ones
+static REBCNT gc_marked = 0; // tally for the current recycle's sample
+
+struct Reb_Pool_Snap {
+    REBCNT free[SYSTEM_POOL];
+    REBCNT system_has;
+};
+
+// Options for Recycle_Nodes()
+//
+enum {
+    RECYCLE_FLAG_SHUTDOWN = 1 << 0, // only roots are live, free the rest
+    RECYCLE_FLAG_MINOR = 1 << 1, // generational: only sweep the nursery
+    RECYCLE_FLAG_SLICED = 1 << 2 // sweep in slices, see GC_Pause_Budget
+};
+
 #define ASSERT_NO_GC_MARKS_PENDING() \
     assert(SER_LEN(GC_Mark_Stack) == 0)
 
+// How many arrays Propagate_All_GC_Marks() has in flight (power of 2)
+//
+#define MARK_PREFETCH_DEPTH 8
+
 
 // Private routines for dealing with the GC mark bit.  Note that not all
 // REBSERs are actually series at the present time, because some are
@@ -134,6 +181,8 @@ static inline void Mark_Rebser_Only(REBSER *s)
 
     if (s->header.bits & SERIES_FLAG_FILE_LINE)
         LINK(s).file->header.bits |= NODE_FLAG_MARKED;
+    if (NOT(s->header.bits & NODE_FLAG_MARKED))
+        ++gc_marked;
     s->header.bits |= NODE_FLAG_MARKED;
 }
 
@@ -190,6 +239,7 @@ static void Queue_Mark_Array_Subclass_Deep(REBARR *a)
         return;
 
     SER(a)->header.bits |= NODE_FLAG_MARKED; // the up-front marking
+    ++gc_marked;
 
     // Add series to the end of the mark stack series.  The length must be
     // maintained accurately to know when the stack needs to grow.
@@ -315,6 +365,8 @@ inline static void Queue_Mark_Singular_Array(REBARR *a) {
 
     assert(NOT_SER_INFO(a, SERIES_INFO_HAS_DYNAMIC));
 
+    if (NOT(SER(a)->header.bits & NODE_FLAG_MARKED))
+        ++gc_marked;
     SER(a)->header.bits |= NODE_FLAG_MARKED;
     Queue_Mark_Opt_Value_Deep(ARR_HEAD(a));
 }
@@ -470,6 +522,8 @@ static void Queue_Mark_Opt_Value_Deep(const RELVAL *v)
             // data for the handle lives in that shared location.  There is
             // nothing the GC needs to see inside a handle.
             //
+            if (NOT(SER(singular)->header.bits & NODE_FLAG_MARKED))
+                ++gc_marked;
             SER(singular)->header.bits |= NODE_FLAG_MARKED;
 
         #if !defined(NDEBUG)
@@ -524,6 +578,8 @@ static void Queue_Mark_Opt_Value_Deep(const RELVAL *v)
         // process, as long as the bit is cleared at the end.
         //
         REBSER *pairing = cast(REBSER*, PAIRING_KEY(v->payload.pair));
+        if (NOT(pairing->header.bits & NODE_FLAG_MARKED))
+            ++gc_marked;
         pairing->header.bits |= NODE_FLAG_MARKED; // read via REBSER
         break; }
 
@@ -716,20 +772,48 @@ static void Propagate_All_GC_Marks(void)
 {
     assert(!in_mark);
 
-    while (SER_LEN(GC_Mark_Stack) != 0) {
-        SET_SERIES_LEN(GC_Mark_Stack, SER_LEN(GC_Mark_Stack) - 1); // still ok
+    // Arrays popped off the mark stack wait in a small FIFO before they are
+    // scanned, with their cells prefetched on the way in.  Scanning an array
+    // pushes its children on the stack, and the next pop would usually take
+    // one of those right back off (hence stall on the cache miss).  The FIFO
+    // gives the memory system a few arrays' worth of work to hide that in.
+    //
+    REBARR *fifo[MARK_PREFETCH_DEPTH];
+    REBCNT fifo_head = 0;
+    REBCNT fifo_len = 0;
+
+    while (TRUE) {
+        while (
+            fifo_len < MARK_PREFETCH_DEPTH && SER_LEN(GC_Mark_Stack) != 0
+        ){
+            SET_SERIES_LEN(GC_Mark_Stack, SER_LEN(GC_Mark_Stack) - 1);
+
+            // Data pointer may change in response to an expansion during
+            // Mark_Array_Deep_Core(), so must be refreshed on each loop.
+            //
+            REBARR *pop = *SER_AT(
+                REBARR*, GC_Mark_Stack, SER_LEN(GC_Mark_Stack)
+            );
 
-        // Data pointer may change in response to an expansion during
-        // Mark_Array_Deep_Core(), so must be refreshed on each loop.
-        //
-        REBARR *a = *SER_AT(REBARR*, GC_Mark_Stack, SER_LEN(GC_Mark_Stack));
+            // Termination is not required in the release build (the length
+            // is enough to know where it ends).  But overwrite with trash in
+            // the debug build.
+            //
+            TRASH_POINTER_IF_DEBUG(
+                *SER_AT(REBARR*, GC_Mark_Stack, SER_LEN(GC_Mark_Stack))
+            );
 
-        // Termination is not required in the release build (the length is
-        // enough to know where it ends).  But overwrite with trash in debug.
-        //
-        TRASH_POINTER_IF_DEBUG(
-            *SER_AT(REBARR*, GC_Mark_Stack, SER_LEN(GC_Mark_Stack))
-        );
+            PREFETCH(ARR_HEAD(pop));
+            fifo[(fifo_head + fifo_len) % MARK_PREFETCH_DEPTH] = pop;
+            ++fifo_len;
+        }
+
+        if (fifo_len == 0)
+            break;
+
+        REBARR *a = fifo[fifo_head];
+        fifo_head = (fifo_head + 1) % MARK_PREFETCH_DEPTH;
+        --fifo_len;
 
         // We should have marked this series at queueing time to keep it from
         // being doubly added before the queue had a chance to be processed
@@ -857,12 +941,14 @@ static void Propagate_All_GC_Marks(void)
             //
             // Voids are illegal in most arrays, but the varlist of a context
             // uses void values to denote that the variable is not set.  Also
-            // reified C va_lists as Do_Core() sources can have them.
+            // reified C va_lists as Do_Core() sources can have them, and the
+            // pairlist of a map has them as the values of removed keys.
             //
             if (NOT(IS_BLANK_RAW(v)) && IS_VOID(v)) {
                 if(
                     !GET_SER_FLAG(a, ARRAY_FLAG_VARLIST)
                     && !GET_SER_FLAG(a, ARRAY_FLAG_VOIDS_LEGAL)
+                    && !GET_SER_FLAG(a, ARRAY_FLAG_PAIRLIST)
                 )
                     panic(a);
             }
@@ -929,7 +1015,7 @@ static void Mark_Root_Series(void)
     for (seg = Mem_Pools[SER_POOL].segs; seg; seg = seg->next) {
         REBSER *s = cast(REBSER *, seg + 1);
         REBCNT n;
-        for (n = Mem_Pools[SER_POOL].units; n > 0; --n, ++s) {
+        for (n = SEG_UNITS(&Mem_Pools[SER_POOL], seg); n > 0; --n, ++s) {
             //
             // !!! A smarter switch statement here could do this more
             // optimally...see the sweep code for an example.
@@ -1029,7 +1115,10 @@ static void Mark_Data_Stack(void)
         if (VAL_TYPE(stackval) == REB_0_PICKUP)
             continue;
 
-        Queue_Mark_Value_Deep(stackval);
+        // The registers of a compiled function body are on the data stack,
+        // and may be void (see %c-bytecode.c)
+        //
+        Queue_Mark_Opt_Value_Deep(stackval);
     }
 
     Propagate_All_GC_Marks();
@@ -1284,17 +1373,509 @@ static void Mark_Frame_Stack_Deep(void)
 
 
 //
-//  Sweep_Series: C
+//  Track_Young_Node: C
 //
-// Scans all series nodes (REBSER structs) in all segments that are part of
-// the SER_POOL.  If a series had its lifetime management delegated to the
-// garbage collector with MANAGE_SERIES(), then if it didn't get "marked" as
-// live during the marking phase then free it.
+// Called when a node becomes managed while generational recycling is on.
+// The nursery is the only part of the pool a minor recycle sweeps, so any
+// managed node that isn't in it must be old (e.g. have a sticky mark).
+//
+void Track_Young_Node(REBNOD *node)
+{
+    assert(GC_Generational);
+
+    if (SER_FULL(GC_Nursery))
+        Extend_Series(GC_Nursery, 8);
+    *SER_AT(REBNOD*, GC_Nursery, SER_LEN(GC_Nursery)) = node;
+    SET_SERIES_LEN(GC_Nursery, SER_LEN(GC_Nursery) + 1);
+}
+
+
+//
+//  Pin_Young_Node: C
+//
+// Write barrier for the one case the remembered set doesn't cover: a young
+// node being referenced from an old array that was frozen, and hence is no
+// longer rescanned by minor recycles (see GC_Barrier_Node()).  The node is
+// treated as a root by the next minor recycle, which promotes it.
+//
+void Pin_Young_Node(REBNOD *node)
+{
+    assert(GC_Generational);
+
+    if (SER_FULL(GC_Pinned))
+        Extend_Series(GC_Pinned, 8);
+    *SER_AT(REBNOD*, GC_Pinned, SER_LEN(GC_Pinned)) = node;
+    SET_SERIES_LEN(GC_Pinned, SER_LEN(GC_Pinned) + 1);
+}
+
+
 //
-static REBCNT Sweep_Series(void)
+//  Is_Watched_Node: C
+//
+// Old nodes that might be updated to point at a young node after they were
+// promoted.  These are kept in GC_Watched, so a minor recycle can check the
+// cards they cover for writes.  Deeply frozen plain arrays (e.g. function
+// bodies) are left out, see Pin_Young_Node() for that case.  So are pairings
+// that aren't roots (e.g. PAIR!s), since those are never written to.
+//
+static inline REBOOL Is_Watched_Node(REBSER *s)
+{
+    if (s->header.bits & NODE_FLAG_CELL)
+        return LOGICAL(s->header.bits & NODE_FLAG_ROOT);
+
+    if (NOT(s->header.bits & SERIES_FLAG_ARRAY))
+        return FALSE;
+
+    if (NOT_SER_INFO(s, SERIES_INFO_FROZEN))
+        return TRUE;
+
+    return LOGICAL(
+        s->header.bits & (
+            ARRAY_FLAG_VARLIST | ARRAY_FLAG_PARAMLIST | ARRAY_FLAG_PAIRLIST
+        )
+    );
+}
+
+
+//
+//  Dirty_Cards: C
+//
+// GC_Barrier_Write() for a range of memory, for when cells have been put in
+// place without going through the cell writing routines (e.g. by memcpy()
+// to a new data allocation in Expand_Series()).
+//
+void Dirty_Cards(const void *p, REBCNT size)
+{
+    if (NOT(GC_Generational) || size == 0)
+        return;
+
+    REBUPT card = cast(REBUPT, p) >> GC_CARD_SHIFT;
+    REBUPT last = (cast(REBUPT, p) + size - 1) >> GC_CARD_SHIFT;
+    if (last - card >= GC_NUM_CARDS) {
+        memset(GC_Cards, 1, GC_NUM_CARDS);
+        return;
+    }
+
+    for (; card <= last; ++card)
+        GC_Cards[card & (GC_NUM_CARDS - 1)] = 1;
+}
+
+
+//
+//  Dirty_Series_Cards: C
+//
+// Dirty_Cards() for an array's node and all of its data (e.g. when its
+// content has been swapped with another array's).
+//
+void Dirty_Series_Cards(REBSER *s)
+{
+    if (NOT(GC_Generational) || NOT_SER_FLAG(s, SERIES_FLAG_ARRAY))
+        return;
+
+    Dirty_Cards(s, sizeof(REBSER)); // covers content of non-dynamic arrays
+    if (GET_SER_INFO(s, SERIES_INFO_HAS_DYNAMIC))
+        Dirty_Cards(SER_DATA_RAW(s), SER_REST(s) * SER_WIDE(s));
+}
+
+
+//
+//  Any_Dirty_Cards: C
+//
+static REBOOL Any_Dirty_Cards(const void *p, REBCNT size)
+{
+    REBUPT card = cast(REBUPT, p) >> GC_CARD_SHIFT;
+    REBUPT last = (cast(REBUPT, p) + size - 1) >> GC_CARD_SHIFT;
+    if (last - card >= GC_NUM_CARDS)
+        return TRUE; // covers the whole table
+
+    for (; card <= last; ++card) {
+        if (GC_Cards[card & (GC_NUM_CARDS - 1)])
+            return TRUE;
+    }
+    return FALSE;
+}
+
+
+//
+//  Is_Dirty_Node: C
+//
+// Could the old node have been written to since the last recycle?  That is
+// if any card covering the node itself (where the LINK() and MISC() fields
+// and any non-dynamic content are) or the array's data is dirty.
+//
+static REBOOL Is_Dirty_Node(REBSER *s)
+{
+    if (s->header.bits & NODE_FLAG_CELL)
+        return Any_Dirty_Cards(s, sizeof(REBVAL) * 2); // pairing
+
+    if (Any_Dirty_Cards(s, sizeof(REBSER)))
+        return TRUE;
+
+    if (NOT_SER_INFO(s, SERIES_INFO_HAS_DYNAMIC))
+        return FALSE;
+
+    return Any_Dirty_Cards(SER_DATA_RAW(s), SER_REST(s) * SER_WIDE(s));
+}
+
+
+//
+//  Promote_Node: C
+//
+// A marked node surviving a generational recycle keeps its mark, which is
+// what makes it "old".  Minor recycles will not queue it again, and the
+// nursery sweep will not consider it.
+//
+static void Promote_Node(REBSER *s)
+{
+    assert(s->header.bits & NODE_FLAG_MARKED);
+
+    if (Is_Watched_Node(s)) {
+        if (SER_FULL(GC_Watched))
+            Extend_Series(GC_Watched, 8);
+        *SER_AT(REBNOD*, GC_Watched, SER_LEN(GC_Watched)) = NOD(s);
+        SET_SERIES_LEN(GC_Watched, SER_LEN(GC_Watched) + 1);
+    }
+
+    ++GC_Promoted;
+}
+
+
+//
+//  Queue_Remembered_Nodes: C
+//
+// First step of a minor recycle.  After any recycle, old nodes only refer
+// to other old nodes.  The only way an old node can refer to a young one is
+// if it was written to since, and every such write went through the barrier
+// in GC_Barrier_Write().  So the "remembered set" is the watched old nodes
+// with a dirty card, and only those are rescanned.  The cards are then
+// cleared for the next minor recycle.
+//
+// Drops watched entries that are no longer old (freed, or a pairing that was
+// unmanaged) or that no longer need watching (an array frozen since the last
+// recycle, which is rescanned one last time here if it is dirty).
+//
+// Pinned nodes are queued as roots, then the pin list is emptied.
+//
+static void Queue_Remembered_Nodes(void)
+{
+    REBNOD **src = SER_HEAD(REBNOD*, GC_Watched);
+    REBNOD **tail = src + SER_LEN(GC_Watched);
+    REBNOD **dest = src;
+
+    for (; src != tail; ++src) {
+        REBSER *s = cast(REBSER*, *src);
+
+        if (IS_FREE_NODE(s))
+            continue;
+        if (
+            (s->header.bits & (NODE_FLAG_MANAGED | NODE_FLAG_MARKED))
+            != (NODE_FLAG_MANAGED | NODE_FLAG_MARKED)
+        ){
+            continue; // not old any longer (or a recycled young node)
+        }
+
+        if (Is_Dirty_Node(s)) {
+            ++gc_marked;
+            if (s->header.bits & NODE_FLAG_CELL) {
+                REBVAL *key = cast(REBVAL*, s);
+                REBVAL *paired = key + 1;
+                Queue_Mark_Value_Deep(key);
+                if (NOT_END(paired))
+                    Queue_Mark_Value_Deep(paired);
+            }
+            else {
+                // The array is already marked, so it can't go through the
+                // usual Queue_Mark_Array_Subclass_Deep()...push it as is.
+                //
+                if (SER_FULL(GC_Mark_Stack))
+                    Extend_Series(GC_Mark_Stack, 8);
+                *SER_AT(REBARR*, GC_Mark_Stack, SER_LEN(GC_Mark_Stack))
+                    = ARR(s);
+                SET_SERIES_LEN(GC_Mark_Stack, SER_LEN(GC_Mark_Stack) + 1);
+            }
+        }
+
+        if (Is_Watched_Node(s))
+            *dest++ = NOD(s);
+    }
+    SET_SERIES_LEN(GC_Watched, dest - SER_HEAD(REBNOD*, GC_Watched));
+
+    CLEAR(GC_Cards, GC_NUM_CARDS);
+
+    REBNOD **pin = SER_HEAD(REBNOD*, GC_Pinned);
+    REBNOD **pin_tail = pin + SER_LEN(GC_Pinned);
+    for (; pin != pin_tail; ++pin) {
+        REBSER *s = cast(REBSER*, *pin);
+        if (IS_FREE_NODE(s) || NOT(s->header.bits & NODE_FLAG_MANAGED))
+            continue;
+        if (GET_SER_FLAG(s, SERIES_FLAG_ARRAY))
+            Queue_Mark_Array_Subclass_Deep(ARR(s));
+        else
+            Mark_Rebser_Only(s);
+    }
+    SET_SERIES_LEN(GC_Pinned, 0);
+
+    Propagate_All_GC_Marks();
+}
+
+
+#if !defined(NDEBUG)
+
+//
+//  Assert_Not_Young: C
+//
+static void Assert_Not_Young(const REBNOD *node, const void *holder)
+{
+    if (node == NULL || (node->header.bits & NODE_FLAG_CELL))
+        return; // no node, or a frame (which is on the stack)
+
+    if (
+        (node->header.bits & (NODE_FLAG_MANAGED | NODE_FLAG_MARKED))
+        == NODE_FLAG_MANAGED
+    ){
+        printf("Old node refers to a young node the minor recycle missed\n");
+        panic (holder);
+    }
+}
+
+
+//
+//  Assert_Cell_Not_Young: C
+//
+static void Assert_Cell_Not_Young(const RELVAL *v)
+{
+    if (IS_END(v))
+        return;
+
+    enum Reb_Kind kind = VAL_TYPE_RAW(v);
+
+    if (Is_Bindable(v))
+        Assert_Not_Young(v->extra.binding, v);
+
+    if (kind >= REB_PATH && kind <= REB_VECTOR)
+        Assert_Not_Young(NOD(v->payload.any_series.series), v);
+    else if (kind == REB_MAP)
+        Assert_Not_Young(NOD(v->payload.any_series.series), v);
+    else if (ANY_CONTEXT_KIND(kind))
+        Assert_Not_Young(NOD(v->payload.any_context.varlist), v);
+    else if (kind == REB_FUNCTION)
+        Assert_Not_Young(NOD(v->payload.function.paramlist), v);
+}
+
+
+//
+//  Check_Old_Generation: C
+//
+// After the mark phase of a minor recycle, no old node may refer to a young
+// node that didn't get marked.  If one does, a write of a reference into the
+// old node skipped GC_Barrier_Write(), and the young node would be freed.
+//
+static void Check_Old_Generation(void)
+{
+    REBSEG *seg;
+    for (seg = Mem_Pools[SER_POOL].segs; seg != NULL; seg = seg->next) {
+        REBSER *s = cast(REBSER*, seg + 1);
+        REBCNT n;
+        for (n = SEG_UNITS(&Mem_Pools[SER_POOL], seg); n > 0; --n, ++s) {
+            if (IS_FREE_NODE(s))
+                continue;
+            if (
+                (s->header.bits & (NODE_FLAG_MANAGED | NODE_FLAG_MARKED))
+                != (NODE_FLAG_MANAGED | NODE_FLAG_MARKED)
+            ){
+                continue;
+            }
+
+            if (s->header.bits & NODE_FLAG_CELL) {
+                RELVAL *key = cast(RELVAL*, s);
+                Assert_Cell_Not_Young(key);
+                if (NOT_END(key + 1))
+                    Assert_Cell_Not_Young(key + 1);
+                continue;
+            }
+
+            if (NOT_SER_FLAG(s, SERIES_FLAG_ARRAY))
+                continue;
+
+            if (GET_SER_FLAG(s, ARRAY_FLAG_VARLIST)) {
+                Assert_Not_Young(LINK(s).keysource, s);
+                if (MISC(s).meta != NULL)
+                    Assert_Not_Young(NOD(CTX_VARLIST(MISC(s).meta)), s);
+            }
+            else if (GET_SER_FLAG(s, ARRAY_FLAG_PARAMLIST)) {
+                Assert_Not_Young(NOD(LINK(s).facade), s);
+                if (MISC(s).meta != NULL)
+                    Assert_Not_Young(NOD(CTX_VARLIST(MISC(s).meta)), s);
+            }
+            else if (GET_SER_FLAG(s, ARRAY_FLAG_PAIRLIST))
+                Assert_Not_Young(NOD(LINK(s).hashlist), s);
+
+            if (GET_SER_INFO(s, SERIES_INFO_INACCESSIBLE))
+                continue;
+
+            RELVAL *v = ARR_HEAD(ARR(s));
+            for (; NOT_END(v); ++v)
+                Assert_Cell_Not_Young(v);
+        }
+    }
+}
+
+#endif
+
+
+//
+//  Mark_All_Gobs: C
+//
+// GOB!s are not tracked generationally, so a minor recycle has to assume
+// any of them might refer to a young series.  Treating them all as roots
+// means the Sweep_Gobs() that follows will just clear their marks.
+//
+static void Mark_All_Gobs(void)
+{
+    REBSEG *seg;
+    for (seg = Mem_Pools[GOB_POOL].segs; seg != NULL; seg = seg->next) {
+        REBGOB *gob = cast(REBGOB*, seg + 1);
+        REBCNT n;
+        for (n = SEG_UNITS(&Mem_Pools[GOB_POOL], seg); n > 0; --n, ++gob) {
+            if (NOT(IS_FREE_NODE(gob)))
+                Queue_Mark_Gob_Deep(gob);
+        }
+    }
+
+    Propagate_All_GC_Marks();
+}
+
+
+//
+//  Unmark_Old_Generation: C
+//
+// A full recycle in generational mode starts by dropping the sticky marks,
+// so that old nodes which have become unreachable can be found.
+//
+static void Unmark_Old_Generation(void)
+{
+    REBSEG *seg;
+    for (seg = Mem_Pools[SER_POOL].segs; seg != NULL; seg = seg->next) {
+        REBSER *s = cast(REBSER*, seg + 1);
+        REBCNT n;
+        for (n = SEG_UNITS(&Mem_Pools[SER_POOL], seg); n > 0; --n, ++s) {
+            if (IS_FREE_NODE(s))
+                continue;
+            s->header.bits &= ~NODE_FLAG_MARKED;
+        }
+    }
+
+    SET_SERIES_LEN(GC_Watched, 0);
+    SET_SERIES_LEN(GC_Pinned, 0);
+    CLEAR(GC_Cards, GC_NUM_CARDS);
+}
+
+
+//
+//  Cache_Dead_Varlist: C
+//
+// A frame that gets reified while its function runs gets a singular varlist,
+// whose only cell is the FRAME! archetype (the args stay on the chunk stack).
+// When such a varlist is found unreachable after its call has ended, it is
+// put in GC_Varlist_Cache instead of being freed, already shaped for the
+// next Context_For_Frame_May_Reify_Managed().  Returns FALSE if the series
+// isn't one of these, and so should be freed as usual.
+//
+// Cached varlists are unmanaged (so sweeps leave them alone) but are not in
+// GC_Manuals.  They are chained through their keysource.
+//
+static inline REBOOL Cache_Dead_Varlist(REBSER *s)
+{
+    const REBUPT flags = SERIES_FLAG_ARRAY | ARRAY_FLAG_VARLIST;
+    const REBUPT info = CONTEXT_INFO_STACK | SERIES_INFO_INACCESSIBLE;
+    if ((s->header.bits & flags) != flags || (s->info.bits & info) != info)
+        return FALSE;
+
+    assert(NOT_SER_INFO(s, SERIES_INFO_HAS_DYNAMIC) && SER_LEN(s) == 1);
+    assert(NOT(s->header.bits & NODE_FLAG_MARKED));
+
+    s->header.bits &= ~NODE_FLAG_MANAGED;
+    s->info.bits &= ~(
+        SERIES_INFO_INACCESSIBLE
+        | SERIES_INFO_HOLD
+        | SERIES_INFO_PROTECTED
+        | SERIES_INFO_FROZEN
+    );
+
+    LINK(s).keysource = cast(REBNOD*, GC_Varlist_Cache); // may be NULL
+    GC_Varlist_Cache = ARR(s);
+    return TRUE;
+}
+
+
+//
+//  Free_Varlist_Cache: C
+//
+// Varlists still cached when the next recycle comes weren't needed in all
+// that time, so they go back to the pool.
+//
+static void Free_Varlist_Cache(void)
+{
+    while (GC_Varlist_Cache != NULL) {
+        REBSER *s = SER(GC_Varlist_Cache);
+        GC_Varlist_Cache = cast(REBARR*, LINK(s).keysource);
+        GC_Kill_Series(s);
+    }
+}
+
+
+//
+//  Sweep_Nursery: C
+//
+// Sweep for a minor recycle: only nodes that became managed since the last
+// recycle are candidates for freeing.  Marked ones are promoted.
+//
+// The same node may appear twice if a pairing was unmanaged, freed, and its
+// node reused for another managed pairing.  The second visit sees either a
+// free node or one already promoted (promoting twice is wasteful, not wrong).
+//
+static REBCNT Sweep_Nursery(void)
 {
     REBCNT count = 0;
 
+    REBNOD **pp = SER_HEAD(REBNOD*, GC_Nursery);
+    REBNOD **tail = pp + SER_LEN(GC_Nursery);
+    for (; pp != tail; ++pp) {
+        REBSER *s = cast(REBSER*, *pp);
+
+        if (IS_FREE_NODE(s))
+            continue;
+        if (NOT(s->header.bits & NODE_FLAG_MANAGED))
+            continue; // unmanaged pairing
+
+        if (s->header.bits & NODE_FLAG_MARKED)
+            Promote_Node(s);
+        else {
+            if (s->header.bits & NODE_FLAG_CELL)
+                Free_Node(SER_POOL, s); // Free_Pairing is for manuals
+            else if (NOT(Cache_Dead_Varlist(s)))
+                GC_Kill_Series(s);
+            ++count;
+        }
+    }
+    SET_SERIES_LEN(GC_Nursery, 0);
+
+    return count;
+}
+
+
+//
+//  Sweep_Node: C
+//
+// If a series had its lifetime management delegated to the garbage collector
+// with MANAGE_SERIES(), then if it didn't get "marked" as live during the
+// marking phase then free it.  Returns 1 if the node was freed, else 0.
+//
+// If `promote` is set, survivors keep their mark and become the "old"
+// generation for the minor recycles that follow.
+//
+static inline REBCNT Sweep_Node(REBSER *s, REBOOL promote)
+{
     // Optimization here depends on SWITCH of a bank of 4 bits.
     //
     static_assert_c(
@@ -1304,92 +1885,352 @@ static REBCNT Sweep_Series(void)
         && (NODE_FLAG_NODE == FLAGIT_LEFT(0)) // 0x8 after right shift
     );
 
+    switch (LEFT_N_BITS(s->header.bits, 4)) {
+    case 0:
+    case 1: // 0x1
+    case 2: // 0x2
+    case 3: // 0x2 + 0x1
+    case 4: // 0x4
+    case 5: // 0x4 + 0x1
+    case 6: // 0x4 + 0x2
+    case 7: // 0x4 + 0x2 + 0x1
+        //
+        // NODE_FLAG_NODE (0x8) is clear.  This signature is
+        // reserved for UTF-8 strings (corresponding to valid ASCII
+        // values in the first byte).
+        //
+        panic (s);
+
+    // v-- Everything below here has NODE_FLAG_NODE set (0x8)
+
+    case 8:
+        // 0x8: unmanaged and unmarked, e.g. a series that was made
+        // with Make_Series() and hasn't been managed.  It doesn't
+        // participate in the GC.  Leave it as is.
+        //
+        break;
+
+    case 9:
+        // 0x8 + 0x1: marked but not managed, this can't happen,
+        // because the marking itself asserts nodes are managed.
+        //
+        panic (s);
+
+    case 10:
+        // 0x8 + 0x2: managed but didn't get marked, should be GC'd
+        //
+        // !!! It would be nice if we could have NODE_FLAG_CELL here
+        // as part of the switch, but see its definition for why it
+        // is at position 8 from left and not an earlier bit.
+        //
+        if (s->header.bits & NODE_FLAG_CELL)
+            Free_Node(SER_POOL, s); // Free_Pairing is for manuals
+        else if (NOT(Cache_Dead_Varlist(s)))
+            GC_Kill_Series(s);
+        return 1;
+
+    case 11:
+        // 0x8 + 0x2 + 0x1: managed and marked, so it's still live.
+        // Don't GC it, just clear the mark (unless generational).
+        //
+        if (promote)
+            Promote_Node(s);
+        else
+            s->header.bits &= ~NODE_FLAG_MARKED;
+        break;
+
+    // v-- Everything below this line has the two leftmost bits set
+    // in the header.  In the *general* case this could be a valid
+    // first byte of a multi-byte sequence in UTF-8...so only the
+    // special bit pattern of the free case uses this.
+
+    case 12:
+        // 0x8 + 0x4: free node, uses special illegal UTF-8 byte
+        //
+        assert(LEFT_8_BITS(s->header.bits) == FREED_SERIES_BYTE);
+        break;
+
+    case 13:
+        // 0x8 + 0x4 + 0x1: "free unmanaged marked node" (?!)
+        //
+        panic (s);
+
+    case 14:
+        // 0x8 + 0x4 + 0x2: "free managed unmarked node" (?!)
+        //
+        panic (s);
+
+    case 15:
+        // 0x8 + 0x4 + 0x2 + 0x1: "free managed marked node" (?!)
+        //
+        panic (s);
+    }
+
+    return 0;
+}
+
+
+//
+//  Sweep_Series: C
+//
+// Scans all series nodes (REBSER structs) in all segments that are part of
+// the SER_POOL, freeing the managed ones that didn't get marked.
+//
+static REBCNT Sweep_Series(REBOOL promote)
+{
+    REBCNT count = 0;
+
     REBSEG *seg;
     for (seg = Mem_Pools[SER_POOL].segs; seg != NULL; seg = seg->next) {
         REBSER *s = cast(REBSER*, seg + 1);
         REBCNT n;
-        for (n = Mem_Pools[SER_POOL].units; n > 0; --n, ++s) {
-            switch (LEFT_N_BITS(s->header.bits, 4)) {
-            case 0:
-            case 1: // 0x1
-            case 2: // 0x2
-            case 3: // 0x2 + 0x1
-            case 4: // 0x4
-            case 5: // 0x4 + 0x1
-            case 6: // 0x4 + 0x2
-            case 7: // 0x4 + 0x2 + 0x1
-                //
-                // NODE_FLAG_NODE (0x8) is clear.  This signature is
-                // reserved for UTF-8 strings (corresponding to valid ASCII
-                // values in the first byte).
-                //
-                panic (s);
+        for (n = SEG_UNITS(&Mem_Pools[SER_POOL], seg); n > 0; --n, ++s)
+            count += Sweep_Node(s, promote);
+    }
 
-            // v-- Everything below here has NODE_FLAG_NODE set (0x8)
+    return count;
+}
 
-            case 8:
-                // 0x8: unmanaged and unmarked, e.g. a series that was made
-                // with Make_Series() and hasn't been managed.  It doesn't
-                // participate in the GC.  Leave it as is.
-                //
-                break;
 
-            case 9:
-                // 0x8 + 0x1: marked but not managed, this can't happen,
-                // because the marking itself asserts nodes are managed.
-                //
-                panic (s);
+//
+//  Mark_Node_Black: C
+//
+// While a sliced sweep is pending, an unmarked managed node that the sweep
+// has yet to reach would be freed.  So nodes becoming managed in that time
+// are marked, and so are nodes revived by weak lookups (e.g. interning a
+// word whose unreachable spelling hasn't been swept yet).  The marks are
+// taken off again when the sweep finishes.
+//
+void Mark_Node_Black(REBNOD *node)
+{
+    assert(GC_Sweeping);
 
-            case 10:
-                // 0x8 + 0x2: managed but didn't get marked, should be GC'd
-                //
-                // !!! It would be nice if we could have NODE_FLAG_CELL here
-                // as part of the switch, but see its definition for why it
-                // is at position 8 from left and not an earlier bit.
-                //
-                if (s->header.bits & NODE_FLAG_CELL)
-                    Free_Node(SER_POOL, s); // Free_Pairing is for manuals
-                else
-                    GC_Kill_Series(s);
-                ++count;
-                break;
+    if (node->header.bits & NODE_FLAG_MARKED)
+        return;
+    node->header.bits |= NODE_FLAG_MARKED;
 
-            case 11:
-                // 0x8 + 0x2 + 0x1: managed and marked, so it's still live.
-                // Don't GC it, just clear the mark.
-                //
-                s->header.bits &= ~NODE_FLAG_MARKED;
-                break;
+    if (SER_FULL(GC_Black))
+        Extend_Series(GC_Black, 8);
+    *SER_AT(REBNOD*, GC_Black, SER_LEN(GC_Black)) = node;
+    SET_SERIES_LEN(GC_Black, SER_LEN(GC_Black) + 1);
+}
 
-            // v-- Everything below this line has the two leftmost bits set
-            // in the header.  In the *general* case this could be a valid
-            // first byte of a multi-byte sequence in UTF-8...so only the
-            // special bit pattern of the free case uses this.
 
-            case 12:
-                // 0x8 + 0x4: free node, uses special illegal UTF-8 byte
-                //
-                assert(LEFT_8_BITS(s->header.bits) == FREED_SERIES_BYTE);
-                break;
+//
+//  Is_Garbage_With_Cleanup: C
+//
+// Freeing most unmarked series just gives memory back to the pools.  But a
+// spelling has to be unlinked from the word table, and a handle's singular
+// array runs the handle's cleanup function.
+//
+static REBOOL Is_Garbage_With_Cleanup(REBSER *s)
+{
+    const REBUPT mask =
+        NODE_FLAG_FREE | NODE_FLAG_MANAGED | NODE_FLAG_MARKED | NODE_FLAG_CELL;
+    if ((s->header.bits & mask) != NODE_FLAG_MANAGED)
+        return FALSE; // free, unmanaged, live, or a pairing
 
-            case 13:
-                // 0x8 + 0x4 + 0x1: "free unmanaged marked node" (?!)
-                //
-                panic (s);
+    if (GET_SER_FLAG(s, SERIES_FLAG_UTF8_STRING))
+        return TRUE;
 
-            case 14:
-                // 0x8 + 0x4 + 0x2: "free managed unmarked node" (?!)
-                //
-                panic (s);
+    if (
+        NOT_SER_FLAG(s, SERIES_FLAG_ARRAY)
+        || GET_SER_INFO(s, SERIES_INFO_HAS_DYNAMIC)
+    ){
+        return FALSE;
+    }
 
-            case 15:
-                // 0x8 + 0x4 + 0x2 + 0x1: "free managed marked node" (?!)
-                //
-                panic (s);
+    RELVAL *v = ARR_HEAD(ARR(s));
+    return LOGICAL(NOT_END(v) && IS_HANDLE(v) && v->extra.singular == ARR(s));
+}
+
+
+//
+//  Finish_Sweep: C
+//
+// Nodes that were marked black kept the mark if the sweep had already passed
+// them, so take it off.
+//
+static void Finish_Sweep(void)
+{
+    assert(GC_Sweeping && sweep_seg == NULL);
+
+    REBNOD **pp = SER_HEAD(REBNOD*, GC_Black);
+    REBNOD **tail = pp + SER_LEN(GC_Black);
+    for (; pp != tail; ++pp) {
+        if (NOT(IS_FREE_NODE(*pp)))
+            (*pp)->header.bits &= ~NODE_FLAG_MARKED;
+    }
+    SET_SERIES_LEN(GC_Black, 0);
+
+    GC_Sweeping = FALSE;
+}
+
+
+//
+//  Snap_Pools: C
+//
+static void Snap_Pools(struct Reb_Pool_Snap *snap)
+{
+    REBCNT n;
+    for (n = 0; n < SYSTEM_POOL; ++n)
+        snap->free[n] = Mem_Pools[n].free;
+    snap->system_has = Mem_Pools[SYSTEM_POOL].has;
+}
+
+
+//
+//  Add_GC_Sample: C
+//
+// Start the next sample in the history, overwriting the oldest one.
+//
+static struct Reb_GC_Sample *Add_GC_Sample(REBSYM kind)
+{
+    struct Reb_GC_Sample *sample = &gc_history[gc_samples % GC_HISTORY_LEN];
+    ++gc_samples;
+    if (kind != SYM_SWEEP)
+        ++gc_recycles;
+
+    CLEARS(sample);
+    sample->kind = kind;
+    sample->ballast = GC_Ballast;
+    return sample;
+}
+
+
+//
+//  Tally_Sweep: C
+//
+// Account for sweeping done since the snapshot in the latest GC sample.
+//
+static void Tally_Sweep(
+    const struct Reb_Pool_Snap *snap,
+    REBI64 usecs,
+    REBCNT count
+){
+    if (gc_samples == 0)
+        return; // e.g. the sweep of a Fill_Sweeplist() recycle
+
+    struct Reb_GC_Sample *sample
+        = &gc_history[(gc_samples - 1) % GC_HISTORY_LEN];
+    sample->sweep += usecs;
+    sample->freed += count;
+
+    REBCNT n;
+    for (n = 0; n < SYSTEM_POOL; ++n) {
+        if (Mem_Pools[n].free <= snap->free[n])
+            continue; // a handle's cleanup may have made nodes
+        REBCNT units = Mem_Pools[n].free - snap->free[n];
+        sample->pools[n] += units;
+        sample->reclaimed += cast(REBI64, units) * Mem_Pools[n].wide;
+    }
+    if (Mem_Pools[SYSTEM_POOL].has < snap->system_has)
+        sample->reclaimed += snap->system_has - Mem_Pools[SYSTEM_POOL].has;
+
+    sample->live = Mem_Pools[SER_POOL].has - Mem_Pools[SER_POOL].free;
+}
+
+
+//
+//  Sweep_Series_Slice: C
+//
+// Continue a pending sweep, stopping once `usecs` microseconds have passed
+// (0 means run to the end).  Marking is still done all at once: without a
+// write barrier on every cell store there is no way to let the evaluator
+// mutate arrays in the middle of it.  But the marks can't change once it is
+// over, so the sweep can be interleaved with evaluation.
+//
+static REBCNT Sweep_Series_Slice(REBCNT usecs)
+{
+    assert(GC_Sweeping && NOT(in_sweep));
+    in_sweep = TRUE;
+
+    struct Reb_Pool_Snap snap;
+    Snap_Pools(&snap);
+
+    REBI64 start = OS_DELTA_TIME(0);
+    REBPOL *pool = &Mem_Pools[SER_POOL];
+    REBCNT count = 0;
+    REBCNT visited = 0;
+
+    while (sweep_seg != NULL) {
+        REBSER *s = cast(REBSER*, sweep_seg + 1)
+            + (SEG_UNITS(pool, sweep_seg) - sweep_left);
+        for (; sweep_left > 0; --sweep_left, ++s) {
+            if (
+                usecs != 0
+                && ++visited % 256 == 0
+                && OS_DELTA_TIME(start) >= usecs
+            ){
+                in_sweep = FALSE;
+                Tally_Sweep(&snap, OS_DELTA_TIME(start), count);
+                return count;
+            }
+            count += Sweep_Node(s, FALSE);
+        }
+
+        sweep_seg = sweep_seg->next;
+        if (sweep_seg != NULL)
+            sweep_left = SEG_UNITS(pool, sweep_seg);
+    }
+
+    in_sweep = FALSE;
+    Finish_Sweep();
+    Tally_Sweep(&snap, OS_DELTA_TIME(start), count);
+    return count;
+}
+
+
+//
+//  Sweep_Lazily: C
+//
+// Make_Node() calls this when the series pool has no free nodes while a
+// sliced sweep is pending, so garbage gets reused before the pool is grown.
+// It sweeps whole segments until at least one node has come free.
+//
+// The caller may be in the middle of anything (e.g. interning a spelling),
+// so it stops short of garbage whose freeing has effects outside the pool.
+// Those nodes are left for the next slice from Recycle() to handle.
+//
+REBCNT Sweep_Lazily(void)
+{
+    assert(GC_Sweeping);
+
+    if (in_sweep)
+        return 0;
+    in_sweep = TRUE;
+
+    struct Reb_Pool_Snap snap;
+    Snap_Pools(&snap);
+
+    REBI64 start = OS_DELTA_TIME(0);
+    REBPOL *pool = &Mem_Pools[SER_POOL];
+    REBCNT count = 0;
+
+    while (sweep_seg != NULL) {
+        REBSER *s = cast(REBSER*, sweep_seg + 1)
+            + (SEG_UNITS(pool, sweep_seg) - sweep_left);
+        for (; sweep_left > 0; --sweep_left, ++s) {
+            if (Is_Garbage_With_Cleanup(s)) {
+                in_sweep = FALSE;
+                Tally_Sweep(&snap, OS_DELTA_TIME(start), count);
+                return count;
             }
+            count += Sweep_Node(s, FALSE);
         }
+
+        sweep_seg = sweep_seg->next;
+        if (sweep_seg != NULL)
+            sweep_left = SEG_UNITS(pool, sweep_seg);
+
+        if (pool->first != NULL)
+            break;
     }
 
+    in_sweep = FALSE;
+    if (sweep_seg == NULL)
+        Finish_Sweep();
+    Tally_Sweep(&snap, OS_DELTA_TIME(start), count);
     return count;
 }
 
@@ -1410,7 +2251,7 @@ REBCNT Fill_Sweeplist(REBSER *sweeplist)
     for (seg = Mem_Pools[SER_POOL].segs; seg != NULL; seg = seg->next) {
         REBSER *s = cast(REBSER*, seg + 1);
         REBCNT n;
-        for (n = Mem_Pools[SER_POOL].units; n > 0; --n, ++s) {
+        for (n = SEG_UNITS(&Mem_Pools[SER_POOL], seg); n > 0; --n, ++s) {
             switch (LEFT_N_BITS(s->header.bits, 4)) {
             case 9: // 0x8 + 0x1
                 assert(IS_SERIES_MANAGED(s));
@@ -1450,14 +2291,27 @@ REBCNT Fill_Sweeplist(REBSER *sweeplist)
 
 
 //
-//  Recycle_Core: C
+//  Recycle_Nodes: C
 //
 // Recycle memory no longer needed.  If sweeplist is not NULL, then it needs
 // to be a series whose width is sizeof(REBSER*), and it will be filled with
 // the list of series that *would* be recycled.
 //
-REBCNT Recycle_Core(REBOOL shutdown, REBSER *sweeplist)
+// A minor recycle is only possible in generational mode.  It marks from the
+// roots plus the remembered old nodes, and then only sweeps the nursery.
+// Everything which survives any recycle in generational mode keeps its mark.
+//
+// A sliced recycle does all the marking, but only sweeps for as long as the
+// GC_Pause_Budget allows.  The rest is done by later calls to Recycle().
+//
+// Recycles which finish their sweep (other than minor ones) end by giving
+// back pool segments beyond the GC_Pool_Slack, see Free_Spare_Segments().
+//
+static REBCNT Recycle_Nodes(REBFLGS flags, REBSER *sweeplist)
 {
+    REBOOL shutdown = LOGICAL(flags & RECYCLE_FLAG_SHUTDOWN);
+    REBOOL minor = LOGICAL(flags & RECYCLE_FLAG_MINOR);
+
     // Ordinarily, it should not be possible to spawn a recycle during a
     // recycle.  But when debug code is added into the recycling code, it
     // could cause a recursion.  Be tolerant of such recursions to make that
@@ -1485,8 +2339,32 @@ REBCNT Recycle_Core(REBOOL shutdown, REBSER *sweeplist)
 
     ASSERT_NO_GC_MARKS_PENDING();
 
+    REBI64 start = OS_DELTA_TIME(0);
+
+    if (GC_Sweeping)
+        Sweep_Series_Slice(0); // marking needs the previous sweep to be done
+
+    // Shutdown and sweeplist recycles aren't interesting to the telemetry
+    //
+    struct Reb_GC_Sample *sample = NULL;
+    if (NOT(shutdown) && sweeplist == NULL) {
+        if (minor)
+            sample = Add_GC_Sample(SYM_MINOR);
+        else if (flags & RECYCLE_FLAG_SLICED)
+            sample = Add_GC_Sample(SYM_SLICED);
+        else
+            sample = Add_GC_Sample(SYM_FULL);
+    }
+
     Reify_Any_C_Valist_Frames();
 
+    if (minor) {
+        assert(GC_Generational && NOT(GC_Major_Pending));
+        assert(NOT(shutdown) && sweeplist == NULL);
+    }
+    else if (GC_Generational)
+        Unmark_Old_Generation();
+
 
 #if !defined(NDEBUG)
     PG_Reb_Stats->Recycle_Counter++;
@@ -1507,6 +2385,17 @@ REBCNT Recycle_Core(REBOOL shutdown, REBSER *sweeplist)
     // (In particular because that is when pairing series whose lifetimes
     // are bound to frames will be freed, if the frame is expired.)
     //
+    REBI64 mark_start = OS_DELTA_TIME(0);
+    gc_marked = 0;
+
+    // Anything not reachable now may be freed by this recycle, and its node
+    // reused, so pointers cached since the last one can't be trusted.
+    //
+    ++GC_Epoch;
+
+    if (minor)
+        Queue_Remembered_Nodes();
+
     Mark_Root_Series();
 
     if (!shutdown) {
@@ -1523,23 +2412,67 @@ REBCNT Recycle_Core(REBOOL shutdown, REBSER *sweeplist)
 
         Mark_Devices_Deep();
 
+        if (minor)
+            Mark_All_Gobs();
     }
 
     // SWEEPING PHASE
 
     ASSERT_NO_GC_MARKS_PENDING();
 
+#if !defined(NDEBUG)
+    if (minor)
+        Check_Old_Generation();
+#endif
+
+    if (sample != NULL) {
+        sample->mark = OS_DELTA_TIME(mark_start);
+        sample->marked = gc_marked;
+    }
+
+    Free_Varlist_Cache();
+
+    struct Reb_Pool_Snap snap;
+    Snap_Pools(&snap);
+
+    REBI64 sweep_start = OS_DELTA_TIME(0);
     REBCNT count = 0;
+    REBCNT tallied = 0; // Sweep_Series_Slice() does its own accounting
 
     if (sweeplist != NULL) {
     #if defined(NDEBUG)
         panic (sweeplist);
     #else
         count += Fill_Sweeplist(sweeplist);
+        if (GC_Generational)
+            GC_Major_Pending = TRUE; // marks were cleared, lists are stale
     #endif
     }
+    else if (minor)
+        count += Sweep_Nursery();
+    else if (GC_Generational && NOT(shutdown)) {
+        GC_Promoted = 0;
+        count += Sweep_Series(TRUE);
+        SET_SERIES_LEN(GC_Nursery, 0);
+
+        GC_Old_Count = GC_Promoted;
+        GC_Promoted = 0;
+        GC_Major_Pending = FALSE;
+    }
+    else if (flags & RECYCLE_FLAG_SLICED) {
+        assert(NOT(GC_Generational) && NOT(shutdown));
+
+        GC_Sweeping = TRUE;
+        sweep_seg = Mem_Pools[SER_POOL].segs;
+        sweep_left = SEG_UNITS(&Mem_Pools[SER_POOL], sweep_seg);
+        tallied = Sweep_Series_Slice(GC_Pause_Budget);
+        count += tallied;
+
+        Snap_Pools(&snap);
+        sweep_start = OS_DELTA_TIME(0);
+    }
     else
-        count += Sweep_Series();
+        count += Sweep_Series(FALSE);
 
     // !!! The intent is for GOB! to be unified in the REBNOD pattern, the
     // way that the FFI structures were.  So they are not included in the
@@ -1548,6 +2481,9 @@ REBCNT Recycle_Core(REBOOL shutdown, REBSER *sweeplist)
     //
     Sweep_Gobs();
 
+    if (sample != NULL)
+        Tally_Sweep(&snap, OS_DELTA_TIME(sweep_start), count - tallied);
+
 #if !defined(NDEBUG)
     // Compute new stats:
     PG_Reb_Stats->Recycle_Series
@@ -1587,12 +2523,18 @@ REBCNT Recycle_Core(REBOOL shutdown, REBSER *sweeplist)
 
         GC_Ballast = VAL_INT32(TASK_BALLAST);
 
+        if (NOT(minor) && sweeplist == NULL && NOT(GC_Sweeping))
+            Free_Spare_Segments(GC_Pool_Slack);
+
         if (Reb_Opts->watch_recycle)
             Debug_Fmt(RM_WATCH_RECYCLE, count);
     }
 
     ASSERT_NO_GC_MARKS_PENDING();
 
+    if (sample != NULL)
+        sample->pause = OS_DELTA_TIME(start);
+
 #if !defined(NDEBUG)
     GC_Recycling = FALSE;
 #endif
@@ -1601,16 +2543,53 @@ REBCNT Recycle_Core(REBOOL shutdown, REBSER *sweeplist)
 }
 
 
+//
+//  Recycle_Core: C
+//
+// Full recycle of memory no longer needed (see Recycle_Nodes() for the
+// meaning of the parameters).
+//
+REBCNT Recycle_Core(REBOOL shutdown, REBSER *sweeplist)
+{
+    return Recycle_Nodes(shutdown ? RECYCLE_FLAG_SHUTDOWN : 0, sweeplist);
+}
+
+
 //
 //  Recycle: C
 //
-// Recycle memory no longer needed.
+// Recycle memory no longer needed.  This is what automatic recycling uses,
+// so in generational mode it is usually a minor recycle.  A full one is
+// done when the old generation has grown by half since the last full one.
+//
+// With a GC_Pause_Budget, this only sweeps for that long...and calls made
+// while that sweep is pending just continue it.
 //
 REBCNT Recycle(void)
 {
+    if (GC_Sweeping) {
+        REBI64 start = OS_DELTA_TIME(0);
+        struct Reb_GC_Sample *sample = Add_GC_Sample(SYM_SWEEP);
+
+        REBCNT swept = Sweep_Series_Slice(GC_Pause_Budget); // tallies sample
+        if (NOT(GC_Sweeping))
+            Free_Spare_Segments(GC_Pool_Slack);
+
+        sample->pause = OS_DELTA_TIME(start);
+        return swept;
+    }
+
     // Default to not passing the `shutdown` flag.
     //
-    REBCNT n = Recycle_Core(FALSE, NULL);
+    REBFLGS flags = 0;
+    if (GC_Generational) {
+        if (NOT(GC_Major_Pending) && GC_Promoted <= GC_Old_Count / 2)
+            flags |= RECYCLE_FLAG_MINOR;
+    }
+    else if (GC_Pause_Budget != 0)
+        flags |= RECYCLE_FLAG_SLICED;
+
+    REBCNT n = Recycle_Nodes(flags, NULL);
 
 #ifdef DOUBLE_RECYCLE_TEST
     //
@@ -1619,7 +2598,7 @@ REBCNT Recycle(void)
     // shouldn't crash.)  This is an expensive check, but helpful to try if
     // it seems a GC left things in a bad state that crashed a later GC.
     //
-    REBCNT n2 = Recycle_Core(FALSE, NULL);
+    REBCNT n2 = Recycle_Nodes(flags, NULL);
     assert(n2 == 0);
 #endif
 
@@ -1627,6 +2606,113 @@ REBCNT Recycle(void)
 }
 
 
+// Append a `name:` to a stats block, returning the cell for its value
+//
+static REBVAL *Append_GC_Stat(REBARR *a, REBSYM name)
+{
+    Init_Set_Word(Alloc_Tail_Array(a), Canon(name));
+    return Alloc_Tail_Array(a);
+}
+
+static int Compare_Pauses(void *thunk, const void *v1, const void *v2)
+{
+    UNUSED(thunk);
+    REBI64 a = *cast(const REBI64*, v1);
+    REBI64 b = *cast(const REBI64*, v2);
+    return a < b ? -1 : (a > b ? 1 : 0);
+}
+
+
+//
+//  Make_GC_Stats_Array: C
+//
+// The telemetry of recent GC pauses, for STATS/GC.  This gives back a block
+// shaped like:
+//
+//     recycles: 10 ;-- total count, not just the ones in the history
+//     compacted: 65536 ;-- total bytes freed by RECYCLE/COMPACT
+//     pause: [p50: 0:00:00.0003 p99: 0:00:00.0012 max: 0:00:00.0012]
+//     history: [
+//         [kind: full pause: ... mark: ... sweep: ... marked: 2790
+//             live: 2811 freed: 630 reclaimed: 81920 ballast: -12
+//             pools: [...]]
+//         ...
+//     ]
+//
+// The history is oldest first, and `pools` has the units given back to each
+// memory pool (the series node pool and the GOB! pool are the last two).
+// `marked` counts the nodes the mark phase marked, plus (for a `minor`
+// recycle) the old ones it rescanned because the write barrier saw them
+// updated.  Samples of kind `sweep` are the later slices of a `sliced`
+// recycle's sweep (they have no `mark`, and aren't counted in `recycles`).
+//
+REBARR *Make_GC_Stats_Array(void)
+{
+    REBCNT num = MIN(gc_samples, GC_HISTORY_LEN);
+    REBCNT first = gc_samples - num; // oldest sample still in the ring
+
+    REBARR *stats = Make_Array(8);
+    Init_Integer(Append_GC_Stat(stats, SYM_RECYCLES), gc_recycles);
+    Init_Integer(Append_GC_Stat(stats, SYM_COMPACTED), GC_Compacted);
+
+    REBARR *pause = Make_Array(6);
+    if (num != 0) {
+        REBI64 *pauses = ALLOC_N(REBI64, num);
+        REBCNT n;
+        for (n = 0; n < num; ++n)
+            pauses[n] = gc_history[n].pause;
+        reb_qsort_r(pauses, num, sizeof(REBI64), NULL, &Compare_Pauses);
+
+        Init_Time_Nanoseconds(
+            Append_GC_Stat(pause, SYM_P50), pauses[(num - 1) / 2] * 1000
+        );
+        Init_Time_Nanoseconds(
+            Append_GC_Stat(pause, SYM_P99),
+            pauses[((num - 1) * 99) / 100] * 1000
+        );
+        Init_Time_Nanoseconds(
+            Append_GC_Stat(pause, SYM_MAX), pauses[num - 1] * 1000
+        );
+        FREE_N(REBI64, num, pauses);
+    }
+    Init_Block(Append_GC_Stat(stats, SYM_PAUSE), pause);
+
+    REBARR *history = Make_Array(num);
+    REBCNT i;
+    for (i = first; i != gc_samples; ++i) {
+        const struct Reb_GC_Sample *sample = &gc_history[i % GC_HISTORY_LEN];
+
+        REBARR *a = Make_Array(20);
+        Init_Word(Append_GC_Stat(a, SYM_KIND), Canon(sample->kind));
+        Init_Time_Nanoseconds(
+            Append_GC_Stat(a, SYM_PAUSE), sample->pause * 1000
+        );
+        Init_Time_Nanoseconds(
+            Append_GC_Stat(a, SYM_MARK), sample->mark * 1000
+        );
+        Init_Time_Nanoseconds(
+            Append_GC_Stat(a, SYM_SWEEP), sample->sweep * 1000
+        );
+        Init_Integer(Append_GC_Stat(a, SYM_MARKED), sample->marked);
+        Init_Integer(Append_GC_Stat(a, SYM_LIVE), sample->live);
+        Init_Integer(Append_GC_Stat(a, SYM_FREED), sample->freed);
+        Init_Integer(Append_GC_Stat(a, SYM_RECLAIMED), sample->reclaimed);
+        Init_Integer(Append_GC_Stat(a, SYM_BALLAST), sample->ballast);
+
+        REBARR *pools = Make_Array(SYSTEM_POOL);
+        REBCNT n;
+        for (n = 0; n < SYSTEM_POOL; ++n)
+            Init_Integer(Alloc_Tail_Array(pools), sample->pools[n]);
+        Init_Block(Append_GC_Stat(a, SYM_POOLS), pools);
+
+        Init_Block(Alloc_Tail_Array(history), a);
+    }
+    Init_Block(Append_GC_Stat(stats, SYM_HISTORY), history);
+
+    return stats;
+}
+
+
 //
 //  Guard_Node_Core: C
 //
@@ -1691,13 +2777,16 @@ void Guard_Node_Core(const REBNOD *node)
 //
 REBARR *Snapshot_All_Functions(void)
 {
+    if (GC_Sweeping)
+        Sweep_Series_Slice(0); // don't pick up unswept garbage functions
+
     REBDSP dsp_orig = DSP;
 
     REBSEG *seg;
     for (seg = Mem_Pools[SER_POOL].segs; seg != NULL; seg = seg->next) {
         REBSER *s = cast(REBSER*, seg + 1);
         REBCNT n;
-        for (n = Mem_Pools[SER_POOL].units; n > 0; --n, ++s) {
+        for (n = SEG_UNITS(&Mem_Pools[SER_POOL], seg); n > 0; --n, ++s) {
             switch (s->header.bits & 0x7) {
             case 5:
                 // A managed REBSER which has no cell mask and is marked as
@@ -1741,6 +2830,68 @@ void Startup_GC(void)
     //
     GC_Mark_Stack = Make_Series(100, sizeof(REBARR*));
     TERM_SEQUENCE(GC_Mark_Stack);
+
+    // Bookkeeping for RECYCLE/GENERATIONAL (off by default)
+    //
+    GC_Generational = FALSE;
+    GC_Major_Pending = FALSE;
+    GC_Nursery = Make_Series(100, sizeof(REBNOD*));
+    GC_Watched = Make_Series(100, sizeof(REBNOD*));
+    GC_Cards = ALLOC_N_ZEROFILL(REBYTE, GC_NUM_CARDS);
+    GC_Pinned = Make_Series(15, sizeof(REBNOD*));
+    GC_Old_Count = 0;
+    GC_Promoted = 0;
+
+    // Bookkeeping for RECYCLE/INCREMENTAL (off by default)
+    //
+    GC_Pause_Budget = 0;
+    GC_Sweeping = FALSE;
+    GC_Black = Make_Series(15, sizeof(REBNOD*));
+
+    // Reified frame varlists recycled by the sweep (see Cache_Dead_Varlist)
+    //
+    GC_Varlist_Cache = NULL;
+
+    // Keep as much spare pool memory as is in use (see RECYCLE/SLACK)
+    //
+    GC_Pool_Slack = 100;
+    GC_Compacted = 0;
+
+    // Caches of what was found in live nodes are good until the next recycle
+    //
+    GC_Epoch = 1;
+}
+
+
+//
+//  Set_GC_Generational: C
+//
+// Turning generational mode on can't promote anything right away, because
+// nodes managed before that point were never put in the nursery.  So the
+// first recycle afterward must be a full one.  Turning it off has to drop
+// the sticky marks of the old generation.
+//
+void Set_GC_Generational(REBOOL generational)
+{
+    assert(NOT(GC_Recycling));
+
+    if (generational == GC_Generational)
+        return;
+
+    if (GC_Sweeping)
+        Sweep_Series_Slice(0); // sliced sweeps aren't done in this mode
+
+    if (generational) {
+        GC_Generational = TRUE;
+        GC_Major_Pending = TRUE;
+        GC_Old_Count = 0;
+        GC_Promoted = 0;
+    }
+    else {
+        Unmark_Old_Generation();
+        SET_SERIES_LEN(GC_Nursery, 0);
+        GC_Generational = FALSE;
+    }
 }
 
 
@@ -1749,6 +2900,16 @@ void Startup_GC(void)
 //
 void Shutdown_GC(void)
 {
+    GC_Generational = FALSE;
+    assert(NOT(GC_Sweeping)); // shutdown recycle should have finished it
+
+    Free_Varlist_Cache();
+
+    Free_Series(GC_Black);
+    Free_Series(GC_Pinned);
+    FREE_N(REBYTE, GC_NUM_CARDS, GC_Cards);
+    Free_Series(GC_Watched);
+    Free_Series(GC_Nursery);
     Free_Series(GC_Guarded);
     Free_Series(GC_Mark_Stack);
 }
@@ -1833,7 +2994,7 @@ static REBCNT Sweep_Gobs(void)
         REBGOB *gob = cast(REBGOB*, seg + 1);
 
         REBCNT n;
-        for (n = Mem_Pools[GOB_POOL].units; n > 0; --n, ++gob) {
+        for (n = SEG_UNITS(&Mem_Pools[GOB_POOL], seg); n > 0; --n, ++gob) {
             if (IS_FREE_NODE(gob)) // unused REBNOD
                 continue;
 
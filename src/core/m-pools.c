@@ -64,6 +64,14 @@
 // malloc and free.  You can enable this by setting the environment variable
 // R3_ALWAYS_MALLOC to 1.
 //
+// Series data too big for the pools usually comes from malloc() as well.
+// But on Linux the biggest allocations are mapped directly, so expanding
+// them can use mremap() instead of copying (see MEM_MAP_SIZE).
+//
+
+#ifdef TO_LINUX
+    #define _GNU_SOURCE // for mremap()
+#endif
 
 #include "sys-core.h"
 
@@ -72,6 +80,10 @@
 
 #include "sys-int-funcs.h"
 
+#ifdef MEM_MAP_SERIES
+    #include <sys/mman.h>
+#endif
+
 
 //
 //  Alloc_Mem: C
@@ -195,6 +207,69 @@ void Free_Mem(void *mem, size_t size)
     #endif
 #endif
 
+#ifdef MEM_MAP_SERIES
+    #ifdef NDEBUG
+        #define IS_MAPPED_SIZE(n) \
+            ((n) >= MEM_MAP_SIZE)
+    #else
+        #define IS_MAPPED_SIZE(n) \
+            (!PG_Always_Malloc && (n) >= MEM_MAP_SIZE)
+    #endif
+
+
+// Series data of IS_MAPPED_SIZE() is given its own pages by mmap(), so that
+// Expand_Series() can grow it with mremap().  The kernel can then extend the
+// mapping in place or move its pages, without copying the data.
+//
+static void *Map_Mem(size_t size)
+{
+    PG_Mem_Usage += size;
+    if ((PG_Mem_Limit != 0) && (PG_Mem_Usage > PG_Mem_Limit))
+        Check_Security(Canon(SYM_MEMORY), POL_EXEC, 0);
+
+    void *p = mmap(
+        NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0
+    );
+    if (p == MAP_FAILED) {
+        PG_Mem_Usage -= size;
+        return NULL;
+    }
+
+#ifdef MADV_HUGEPAGE
+    if (size >= MEM_HUGE_PAGE_SIZE)
+        madvise(p, size, MADV_HUGEPAGE); // only a hint, so ignore failure
+#endif
+
+    return p;
+}
+
+static void *Remap_Mem(void *p, size_t size_old, size_t size)
+{
+    PG_Mem_Usage += size - size_old;
+    if ((PG_Mem_Limit != 0) && (PG_Mem_Usage > PG_Mem_Limit))
+        Check_Security(Canon(SYM_MEMORY), POL_EXEC, 0);
+
+    void *remapped = mremap(p, size_old, size, MREMAP_MAYMOVE);
+    if (remapped == MAP_FAILED) {
+        PG_Mem_Usage -= size - size_old;
+        return NULL;
+    }
+
+#ifdef MADV_HUGEPAGE
+    if (size >= MEM_HUGE_PAGE_SIZE)
+        madvise(remapped, size, MADV_HUGEPAGE);
+#endif
+
+    return remapped;
+}
+
+static void Unmap_Mem(void *p, size_t size)
+{
+    munmap(p, size);
+    PG_Mem_Usage -= size;
+}
+#endif
+
 /***********************************************************************
 **
 **  MEMORY POOLS
@@ -249,6 +324,32 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 };
 
 
+// Blocks of the arena for temporaries, see Push_Arena()
+//
+static struct Reb_Arena_Block *Make_Arena_Block(
+    struct Reb_Arena_Block *prev,
+    REBCNT size
+){
+    struct Reb_Arena_Block *a = cast(
+        struct Reb_Arena_Block*, Alloc_Mem(ARENA_BLOCK_HEADER + size)
+    );
+    if (a == NULL)
+        fail (Error_No_Memory(ARENA_BLOCK_HEADER + size));
+
+    a->prev = prev;
+    a->next = NULL;
+    a->base = (prev == NULL) ? 0 : prev->base + prev->used;
+    a->size = size;
+    a->used = 0;
+    return a;
+}
+
+static void Free_Arena_Block(struct Reb_Arena_Block *a)
+{
+    Free_Mem(a, ARENA_BLOCK_HEADER + a->size);
+}
+
+
 //
 //  Startup_Pools: C
 //
@@ -303,6 +404,7 @@ void Startup_Pools(REBINT scale)
 
         Mem_Pools[n].units = (Mem_Pool_Spec[n].units * scale) / unscale;
         if (Mem_Pools[n].units < 2) Mem_Pools[n].units = 2;
+        Mem_Pools[n].max_units = Mem_Pools[n].units * MEM_POOL_MAX_GROWTH;
         Mem_Pools[n].free = 0;
         Mem_Pools[n].has = 0;
     }
@@ -323,7 +425,7 @@ void Startup_Pools(REBINT scale)
     // organized to have some of the logic not in the pools file
 
 #if !defined(NDEBUG)
-    PG_Reb_Stats = ALLOC(REB_STATS);
+    PG_Reb_Stats = ALLOC_ZEROFILL(REB_STATS);
 #endif
 
     // Manually allocated series that GC is not responsible for (unless a
@@ -335,6 +437,10 @@ void Startup_Pools(REBINT scale)
     GC_Manuals = Make_Series_Core(15, sizeof(REBSER *), NODE_FLAG_MANAGED);
     CLEAR_SER_FLAG(GC_Manuals, NODE_FLAG_MANAGED);
 
+    // The arena always has a block, so Push_Arena() need not check for one
+    //
+    TG_Arena = Make_Arena_Block(NULL, ARENA_BLOCK_PAYLOAD);
+
     Prior_Expand = ALLOC_N(REBSER*, MAX_EXPAND_LIST);
     CLEAR(Prior_Expand, sizeof(REBSER*) * MAX_EXPAND_LIST);
     Prior_Expand[0] = (REBSER*)1;
@@ -353,12 +459,17 @@ void Shutdown_Pools(void)
     //
     GC_Kill_Series(GC_Manuals);
 
+    assert(TG_Arena->prev == NULL && TG_Arena->used == 0);
+    if (TG_Arena->next != NULL)
+        Free_Arena_Block(TG_Arena->next);
+    Free_Arena_Block(TG_Arena);
+
 #if !defined(NDEBUG)
     REBSEG *debug_seg = Mem_Pools[SER_POOL].segs;
     for(; debug_seg != NULL; debug_seg = debug_seg->next) {
         REBSER *series = cast(REBSER*, debug_seg + 1);
-        REBCNT n;
-        for (n = Mem_Pools[SER_POOL].units; n > 0; n--, series++) {
+        REBCNT n = SEG_UNITS(&Mem_Pools[SER_POOL], debug_seg);
+        for (; n > 0; n--, series++) {
             if (IS_FREE_NODE(series))
                 continue;
 
@@ -371,13 +482,12 @@ void Shutdown_Pools(void)
     REBCNT pool_num;
     for (pool_num = 0; pool_num < MAX_POOLS; pool_num++) {
         REBPOL *pool = &Mem_Pools[pool_num];
-        REBCNT mem_size = pool->wide * pool->units + sizeof(REBSEG);
 
         REBSEG *seg = pool->segs;
         while (seg) {
             REBSEG *next;
             next = seg->next;
-            FREE_N(char, mem_size, cast(char*, seg));
+            FREE_N(char, seg->size, cast(char*, seg));
             seg = next;
         }
     }
@@ -425,6 +535,11 @@ void Shutdown_Pools(void)
 // the size and units specified when the pool header was created.  The nodes
 // of the pool are linked to the free list.
 //
+// Each time a pool has to be refilled the next segment is made twice as big
+// (up to MEM_POOL_MAX_GROWTH times the initial units), so pools which see a
+// lot of allocation go to the system less often and have fewer segments to
+// walk.  Rarely used pools keep the small sizes from Mem_Pool_Spec.
+//
 static void Fill_Pool(REBPOL *pool)
 {
     REBCNT units = pool->units;
@@ -483,6 +598,9 @@ static void Fill_Pool(REBPOL *pool)
     }
 
     pool->last = node;
+
+    if (pool->units < pool->max_units)
+        pool->units = MIN(pool->units * 2, pool->max_units);
 }
 
 
@@ -490,7 +608,8 @@ static void Fill_Pool(REBPOL *pool)
 //  Make_Node: C
 //
 // Allocate a node from a pool.  If the pool has run out of nodes, it will
-// be refilled.
+// be refilled.  (Though if a sliced sweep is pending, series nodes are first
+// sought by sweeping more of it...see Sweep_Lazily().)
 //
 // The node will not be zero-filled.  However its header bits will be
 // guaranteed to be zero--which is the same as the state of all freed nodes.
@@ -505,8 +624,13 @@ static void Fill_Pool(REBPOL *pool)
 void *Make_Node(REBCNT pool_id)
 {
     REBPOL *pool = &Mem_Pools[pool_id];
-    if (pool->first == NULL)
-        Fill_Pool(pool);
+    if (pool->first == NULL) {
+        if (pool_id == SER_POOL && GC_Sweeping)
+            Sweep_Lazily();
+
+        if (pool->first == NULL)
+            Fill_Pool(pool);
+    }
 
     assert(pool->first != NULL);
 
@@ -571,6 +695,459 @@ void Free_Node(REBCNT pool_id, void *p)
 }
 
 
+// Free node count for one of a pool's segments, see Free_Spare_Segments()
+//
+struct Reb_Seg_Tally {
+    REBSEG *seg;
+    REBCNT free;
+    REBCNT moved; // nodes vacated by Compact_Series_Data()
+    REBOOL release;
+};
+
+static int Compare_Seg_Tallies(void *thunk, const void *v1, const void *v2)
+{
+    UNUSED(thunk);
+    REBUPT a = cast(REBUPT, cast(const struct Reb_Seg_Tally*, v1)->seg);
+    REBUPT b = cast(REBUPT, cast(const struct Reb_Seg_Tally*, v2)->seg);
+    return a < b ? -1 : (a > b ? 1 : 0);
+}
+
+// Binary search for the tally of the segment a node is in
+//
+static struct Reb_Seg_Tally *Find_Seg_Tally(
+    struct Reb_Seg_Tally *tallies,
+    REBCNT num_segs,
+    void *node
+){
+    REBCNT lo = 0;
+    REBCNT hi = num_segs;
+    while (hi - lo > 1) {
+        REBCNT mid = (lo + hi) / 2;
+        if (cast(REBUPT, tallies[mid].seg) < cast(REBUPT, node))
+            lo = mid;
+        else
+            hi = mid;
+    }
+
+    assert(
+        cast(REBUPT, node) > cast(REBUPT, tallies[lo].seg)
+        && (
+            cast(REBUPT, node)
+            < cast(REBUPT, tallies[lo].seg) + tallies[lo].seg->size
+        )
+    );
+    return &tallies[lo];
+}
+
+// Tally the free nodes of each of a pool's segments.  Tallies are sorted by
+// the segment address, so each node on the free list can be looked up.  The
+// caller frees the result with FREE_N().
+//
+static struct Reb_Seg_Tally *Tally_Segments(REBPOL *pool, REBCNT num_segs)
+{
+    struct Reb_Seg_Tally *tallies = ALLOC_N(struct Reb_Seg_Tally, num_segs);
+
+    REBCNT i = 0;
+    REBSEG *seg;
+    for (seg = pool->segs; seg != NULL; seg = seg->next, ++i) {
+        tallies[i].seg = seg;
+        tallies[i].free = 0;
+        tallies[i].moved = 0;
+        tallies[i].release = FALSE;
+    }
+    assert(i == num_segs);
+
+    reb_qsort_r(
+        tallies, num_segs, sizeof(struct Reb_Seg_Tally),
+        NULL, &Compare_Seg_Tallies
+    );
+
+    REBNOD *node;
+    for (node = pool->first; node != NULL; node = node->next_if_free)
+        ++Find_Seg_Tally(tallies, num_segs, node)->free;
+
+    return tallies;
+}
+
+// Free the segments whose tallies say to release them, which must have all
+// their nodes on the free list.  Returns the number of bytes freed.
+//
+static REBU64 Release_Segments(
+    REBPOL *pool,
+    struct Reb_Seg_Tally *tallies,
+    REBCNT num_segs
+){
+    // Take the nodes in the released segments off the free list...
+    //
+    REBNOD **link = &pool->first;
+    pool->last = NULL;
+
+    REBNOD *node;
+    for (node = pool->first; node != NULL; node = node->next_if_free) {
+        if (NOT(Find_Seg_Tally(tallies, num_segs, node)->release)) {
+            *link = node;
+            link = &node->next_if_free;
+            pool->last = node;
+        }
+    }
+    *link = NULL;
+
+    // ...then take the segments off the segment list and free them.
+    //
+    REBU64 freed = 0;
+
+    REBSEG **seg_link = &pool->segs;
+    REBSEG *seg;
+    while ((seg = *seg_link) != NULL) {
+        if (NOT(Find_Seg_Tally(tallies, num_segs, seg + 1)->release)) {
+            seg_link = &seg->next;
+            continue;
+        }
+
+        *seg_link = seg->next;
+
+        REBCNT units = SEG_UNITS(pool, seg);
+        pool->has -= units;
+        pool->free -= units;
+        freed += seg->size;
+        FREE_N(char, seg->size, cast(char*, seg));
+    }
+
+    return freed;
+}
+
+// Number of segments in a pool
+//
+static REBCNT Count_Segments(REBPOL *pool)
+{
+    REBCNT num_segs = 0;
+    REBSEG *seg;
+    for (seg = pool->segs; seg != NULL; seg = seg->next)
+        ++num_segs;
+    return num_segs;
+}
+
+
+//
+//  Free_Spare_Segments: C
+//
+// Nodes go back on their pool's free list, but segments were only ever freed
+// at shutdown...so after a burst of allocation the pools would stay at their
+// high-water mark.  This frees segments that have no nodes in use, as long
+// as the free nodes left over are at least `slack` percent of the used ones.
+// Each pool keeps at least one segment.  Returns the number of bytes freed.
+//
+// The GC's lists of nodes to look at later (for sliced sweeps or minor
+// recycles) may refer to free nodes, so this is only called by recycles that
+// leave those lists empty.
+//
+REBU64 Free_Spare_Segments(REBCNT slack)
+{
+    assert(NOT(GC_Sweeping));
+
+    REBU64 freed = 0;
+
+    REBCNT pool_num;
+    for (pool_num = 0; pool_num < SYSTEM_POOL; ++pool_num) {
+        REBPOL *pool = &Mem_Pools[pool_num];
+
+        REBU64 keep = (cast(REBU64, pool->has - pool->free) * slack) / 100;
+        if (pool->free <= keep)
+            continue;
+
+        REBCNT num_segs = Count_Segments(pool);
+        if (num_segs < 2)
+            continue;
+
+        struct Reb_Seg_Tally *tallies = Tally_Segments(pool, num_segs);
+
+        REBCNT num_released = 0;
+        REBU64 free = pool->free;
+        REBCNT i;
+        for (i = 0; i < num_segs && num_released + 1 < num_segs; ++i) {
+            REBCNT units = SEG_UNITS(pool, tallies[i].seg);
+            if (tallies[i].free == units && free - units >= keep) {
+                tallies[i].release = TRUE;
+                free -= units;
+                ++num_released;
+            }
+        }
+
+        if (num_released != 0)
+            freed += Release_Segments(pool, tallies, num_segs);
+
+        FREE_N(struct Reb_Seg_Tally, num_segs, tallies);
+    }
+
+    return freed;
+}
+
+
+// Put a temporary hold on a series while its data might be moved, unless it
+// already has one (which is then left for its owner to release).
+//
+static void Hold_For_Compaction(REBSER *holds, REBSER *s)
+{
+    if (s == NULL || GET_SER_INFO(s, SERIES_INFO_HOLD))
+        return;
+
+    SET_SER_INFO(s, SERIES_INFO_HOLD);
+
+    if (SER_FULL(holds))
+        Extend_Series(holds, 8);
+    *SER_AT(REBSER*, holds, SER_LEN(holds)) = s;
+    SET_SERIES_LEN(holds, SER_LEN(holds) + 1);
+}
+
+
+// Hold the series whose data a native working on this value could have a
+// pointer into.  (The type is read raw, as frame cells may be ENDs or, in
+// the debug build, unreadable blanks.)
+//
+static void Hold_Value_For_Compaction(REBSER *holds, const RELVAL *v)
+{
+    if (IS_END(v))
+        return;
+
+    enum Reb_Kind kind = VAL_TYPE_RAW(v);
+
+    if (kind >= REB_PATH && kind <= REB_VECTOR)
+        Hold_For_Compaction(holds, VAL_SERIES(v));
+    else if (kind == REB_MAP) {
+        Hold_For_Compaction(holds, SER(MAP_PAIRLIST(VAL_MAP(v))));
+        Hold_For_Compaction(holds, MAP_HASHLIST(VAL_MAP(v)));
+    }
+    else if (ANY_CONTEXT_KIND(kind))
+        Hold_For_Compaction(holds, SER(CTX_KEYLIST(VAL_CONTEXT(v))));
+}
+
+
+//
+//  Compact_Series_Data: C
+//
+// Series data from the pools lands in whatever segment had a free node when
+// it was allocated.  After a lot of churn a pool can have many segments that
+// are mostly empty but still have some node in use, which keeps any of them
+// from being freed.  This moves data out of the emptiest segments into the
+// free nodes of fuller ones, then frees the segments that it empties.  It
+// returns the number of bytes freed.
+//
+// Moving the data means updating `s->content.dynamic.data`, but C code may
+// also have pointers into it.  Natives keep pointers into their arguments'
+// data while calling out to user code (SORT/COMPARE sorts a block's cells in
+// place while running the comparator), and so does anything that locked the
+// series (see SERIES_FLAG_DONT_RELOCATE).  So data is not moved for series
+// which are unmanaged, roots, varlists, paramlists, or held.  Arrays being
+// run by a frame, series in the arguments and cells of functions that are
+// running, and guarded series are given a hold while this runs.  Data
+// allocated outside the pools (see Alloc_Mem()) isn't moved.
+//
+REBU64 Compact_Series_Data(void)
+{
+    assert(NOT(GC_Sweeping));
+
+    REBSER *holds = Make_Series(32, sizeof(REBSER*));
+
+    REBFRM *f;
+    for (f = FS_TOP; f != NULL; f = f->prior) {
+        Hold_For_Compaction(holds, SER(f->source.array));
+        Hold_Value_For_Compaction(holds, f->out);
+        Hold_Value_For_Compaction(holds, &f->cell);
+
+        // A frame still gathering its arguments hasn't handed them to its
+        // function yet, and the cells past the one being filled are garbage.
+        //
+        if (NOT(Is_Function_Frame(f)) || Is_Function_Frame_Fulfilling(f))
+            continue;
+
+        if (f->refine != NULL)
+            Hold_Value_For_Compaction(holds, f->refine);
+
+        REBVAL *param = FUNC_FACADE_HEAD(f->phase);
+        REBVAL *arg = f->args_head;
+        for (; NOT_END(param); ++param, ++arg)
+            Hold_Value_For_Compaction(holds, arg);
+    }
+
+    REBNOD **np = SER_HEAD(REBNOD*, GC_Guarded);
+    REBNOD **np_tail = np + SER_LEN(GC_Guarded);
+    for (; np != np_tail; ++np) {
+        if (NOT((*np)->header.bits & NODE_FLAG_CELL))
+            Hold_For_Compaction(holds, cast(REBSER*, *np));
+        else
+            Hold_Value_For_Compaction(holds, cast(REBVAL*, *np));
+    }
+
+    // Decide which segments of each data pool to empty.  Going in address
+    // order, a segment at most half full is picked if the free nodes in the
+    // other segments can still take everything being moved.  The free nodes
+    // of picked segments go on a side list, so Make_Node() won't use them.
+    //
+    struct Reb_Seg_Tally *tallies[SER_POOL];
+    REBCNT num_segs[SER_POOL];
+    REBNOD *vacated[SER_POOL];
+
+    REBCNT pool_num;
+    for (pool_num = 0; pool_num < SER_POOL; ++pool_num) {
+        REBPOL *pool = &Mem_Pools[pool_num];
+        vacated[pool_num] = NULL;
+
+        num_segs[pool_num] = Count_Segments(pool);
+        if (num_segs[pool_num] < 2) {
+            tallies[pool_num] = NULL;
+            continue;
+        }
+
+        struct Reb_Seg_Tally *t = Tally_Segments(pool, num_segs[pool_num]);
+        tallies[pool_num] = t;
+
+        REBCNT room = pool->free;
+        REBCNT moving = 0;
+        REBCNT num_picked = 0;
+        REBCNT i;
+        for (i = 0; i < num_segs[pool_num]; ++i) {
+            if (num_picked + 1 == num_segs[pool_num])
+                break;
+
+            REBCNT used = SEG_UNITS(pool, t[i].seg) - t[i].free;
+            if (used * 2 > SEG_UNITS(pool, t[i].seg))
+                continue;
+            if (room - t[i].free < moving + used)
+                continue;
+
+            t[i].release = TRUE;
+            room -= t[i].free;
+            moving += used;
+            ++num_picked;
+        }
+
+        REBNOD **link = &pool->first;
+        pool->last = NULL;
+
+        REBNOD *node = pool->first;
+        while (node != NULL) {
+            REBNOD *next = node->next_if_free;
+            if (Find_Seg_Tally(t, num_segs[pool_num], node)->release) {
+                node->next_if_free = vacated[pool_num];
+                vacated[pool_num] = node;
+            }
+            else {
+                *link = node;
+                link = &node->next_if_free;
+                pool->last = node;
+            }
+            node = next;
+        }
+        *link = NULL;
+    }
+
+    // Move the data of every series that can be moved out of those segments
+    //
+    REBSEG *seg;
+    for (seg = Mem_Pools[SER_POOL].segs; seg != NULL; seg = seg->next) {
+        REBSER *s = cast(REBSER*, seg + 1);
+        REBCNT n;
+        for (n = SEG_UNITS(&Mem_Pools[SER_POOL], seg); n > 0; --n, ++s) {
+            if (
+                (s->header.bits & (
+                    NODE_FLAG_FREE | NODE_FLAG_MANAGED | NODE_FLAG_ROOT
+                    | NODE_FLAG_CELL | SERIES_FLAG_DONT_RELOCATE
+                    | ARRAY_FLAG_VARLIST | ARRAY_FLAG_PARAMLIST
+                )) != NODE_FLAG_MANAGED
+            ){
+                continue;
+            }
+            if (
+                NOT_SER_INFO(s, SERIES_INFO_HAS_DYNAMIC)
+                || GET_SER_INFO(s, SERIES_INFO_HOLD)
+            ){
+                continue;
+            }
+
+            REBCNT size = Series_Allocation_Unpooled(s);
+            pool_num = FIND_POOL(size);
+            if (pool_num >= SER_POOL || tallies[pool_num] == NULL)
+                continue;
+
+            REBPOL *pool = &Mem_Pools[pool_num];
+            REBYTE *unbiased = s->content.dynamic.data
+                - SER_WIDE(s) * SER_BIAS(s);
+
+            struct Reb_Seg_Tally *tally = Find_Seg_Tally(
+                tallies[pool_num], num_segs[pool_num], unbiased
+            );
+            if (NOT(tally->release) || pool->first == NULL)
+                continue;
+
+            // The node taken is in a segment that wasn't picked, whose count
+            // of free nodes must go down so it isn't taken for empty below.
+            //
+            REBYTE *moved = cast(REBYTE*, Make_Node(pool_num));
+            --Find_Seg_Tally(
+                tallies[pool_num], num_segs[pool_num], moved
+            )->free;
+            memcpy(moved, unbiased, size);
+            s->content.dynamic.data = moved + SER_WIDE(s) * SER_BIAS(s);
+            Dirty_Series_Cards(s); // see Expand_Series()
+
+            REBNOD *node = cast(REBNOD*, unbiased);
+            struct Reb_Header *alias = &node->header;
+            alias->bits = FLAGBYTE_FIRST(FREED_SERIES_BYTE);
+            node->next_if_free = vacated[pool_num];
+            vacated[pool_num] = node;
+            pool->free++;
+
+            ++tally->moved;
+        }
+    }
+
+    // Give the nodes on the side lists back to their pools, and free the
+    // segments which ended up with no nodes in use.
+    //
+    REBU64 freed = 0;
+
+    for (pool_num = 0; pool_num < SER_POOL; ++pool_num) {
+        struct Reb_Seg_Tally *t = tallies[pool_num];
+        if (t == NULL)
+            continue;
+
+        REBPOL *pool = &Mem_Pools[pool_num];
+
+        REBNOD *node = vacated[pool_num];
+        while (node != NULL) {
+            REBNOD *next = node->next_if_free;
+            node->next_if_free = NULL;
+            if (pool->last == NULL)
+                pool->first = node;
+            else
+                pool->last->next_if_free = node;
+            pool->last = node;
+            node = next;
+        }
+
+        REBCNT i;
+        for (i = 0; i < num_segs[pool_num]; ++i) {
+            t[i].release = LOGICAL(
+                t[i].free + t[i].moved == SEG_UNITS(pool, t[i].seg)
+            );
+        }
+        freed += Release_Segments(pool, t, num_segs[pool_num]);
+
+        FREE_N(struct Reb_Seg_Tally, num_segs[pool_num], t);
+    }
+
+    REBSER **sp = SER_HEAD(REBSER*, holds);
+    REBSER **sp_tail = sp + SER_LEN(holds);
+    for (; sp != sp_tail; ++sp)
+        CLEAR_SER_INFO(*sp, SERIES_INFO_HOLD);
+    Free_Series(holds);
+
+    GC_Compacted += freed; // reported by STATS/GC as `compacted`
+
+    return freed;
+}
+
+
 //
 //  Series_Data_Alloc: C
 //
@@ -629,7 +1206,12 @@ static REBOOL Series_Data_Alloc(REBSER *s, REBCNT length) {
                 CLEAR_SER_FLAG(s, SERIES_FLAG_POWER_OF_2);
         }
 
-        s->content.dynamic.data = ALLOC_N(REBYTE, size);
+    #ifdef MEM_MAP_SERIES
+        if (IS_MAPPED_SIZE(size))
+            s->content.dynamic.data = cast(REBYTE*, Map_Mem(size));
+        else
+    #endif
+            s->content.dynamic.data = ALLOC_N(REBYTE, size);
         if (s->content.dynamic.data == NULL)
             return FALSE;
 
@@ -750,7 +1332,7 @@ REBNOD *Try_Find_Containing_Node_Debug(const void *p)
     for (seg = Mem_Pools[SER_POOL].segs; seg; seg = seg->next) {
         REBSER *s = cast(REBSER*, seg + 1);
         REBCNT n;
-        for (n = Mem_Pools[SER_POOL].units; n > 0; --n, ++s) {
+        for (n = SEG_UNITS(&Mem_Pools[SER_POOL], seg); n > 0; --n, ++s) {
             if (IS_FREE_NODE(s))
                 continue;
 
@@ -963,6 +1545,8 @@ REBSER *Make_Series_Core(REBCNT capacity, REBYTE wide, REBUPT flags)
             GC_Manuals->content.dynamic.len++
         ] = s;
     }
+    else
+        Note_Newly_Managed(NOD(s));
 
     // Since we're not the scanner, the only way we can attribute a file and
     // a line number to a series created at runtime is to examine the frame
@@ -985,6 +1569,132 @@ REBSER *Make_Series_Core(REBCNT capacity, REBYTE wide, REBUPT flags)
 }
 
 
+//
+//  Push_Arena: C
+//
+// Many series are only needed for the duration of one native's work, such
+// as a FORM of a value that is searched for and then thrown away.  Making
+// them the usual way takes a node from the REBSER pool, data from another
+// pool, and a slot in GC_Manuals...all of which have to be given back.
+//
+// The arena is a stack of bytes that is released in bulk.  Push_Arena()
+// gives back a mark, Alloc_Arena() and Make_Arena_Series() bump-allocate
+// from the arena, and Drop_Arena() releases everything allocated since the
+// mark.  Pushes and drops must balance, like DS_PUSH() and DS_DROP_TO().
+// If a fail() happens in between, the arena is dropped back to where it was
+// when the trap was pushed.
+//
+REBCNT Push_Arena(void)
+{
+    return TG_Arena->base + TG_Arena->used;
+}
+
+
+//
+//  Alloc_Arena: C
+//
+// Bump-allocate memory from the arena, aligned to 64-bits.  It is only
+// valid until the Drop_Arena() for the current Push_Arena().
+//
+void *Alloc_Arena(REBCNT size)
+{
+    size = ALIGN(size, sizeof(REBI64));
+
+    struct Reb_Arena_Block *a = TG_Arena;
+    if (a->size - a->used < size) {
+        if (a->next != NULL && a->next->size >= size) {
+            a->next->base = a->base + a->used;
+            a->next->used = 0;
+        }
+        else {
+            if (a->next != NULL)
+                Free_Arena_Block(a->next);
+            a->next = Make_Arena_Block(
+                a, size > ARENA_BLOCK_PAYLOAD ? size : ARENA_BLOCK_PAYLOAD
+            );
+        }
+        a = TG_Arena = a->next;
+    }
+
+    void *p = cast(REBYTE*, a) + ARENA_BLOCK_HEADER + a->used;
+    a->used += size;
+    return p;
+}
+
+
+//
+//  Drop_Arena: C
+//
+// Release everything allocated from the arena since Push_Arena() gave back
+// `mark`.  One block that is no longer in use is kept for the next time the
+// arena grows.
+//
+void Drop_Arena(REBCNT mark)
+{
+    assert(mark <= TG_Arena->base + TG_Arena->used);
+
+    while (mark < TG_Arena->base) {
+        struct Reb_Arena_Block *a = TG_Arena;
+        if (a->next != NULL) {
+            Free_Arena_Block(a->next);
+            a->next = NULL;
+        }
+        TG_Arena = a->prev;
+    }
+
+#if !defined(NDEBUG)
+    //
+    // Trash what was released, to catch use of series after their drop
+    //
+    memset(
+        cast(REBYTE*, TG_Arena) + ARENA_BLOCK_HEADER + (mark - TG_Arena->base),
+        0xBD,
+        TG_Arena->used - (mark - TG_Arena->base)
+    );
+#endif
+
+    TG_Arena->used = mark - TG_Arena->base;
+}
+
+
+//
+//  Make_Arena_Series: C
+//
+// Make a string or binary series whose node and data come from the arena,
+// see Push_Arena().  It is not in GC_Manuals and can't be managed or freed,
+// and as its capacity is fixed, it fails if anything tries to expand it.
+//
+REBSER *Make_Arena_Series(REBCNT capacity, REBCNT wide)
+{
+    assert(wide != 0 && wide != sizeof(REBVAL)); // arrays are not supported
+
+    if (cast(REBU64, capacity) * wide > MAX_I32)
+        fail (Error_No_Memory(cast(REBU64, capacity) * wide));
+
+    REBSER *s = cast(REBSER*, Alloc_Arena(sizeof(REBSER) + capacity * wide));
+
+    s->header.bits = NODE_FLAG_NODE | SERIES_FLAG_FIXED_SIZE;
+    Init_Endlike_Header(&s->info, 0);
+    SER_SET_WIDE(s, wide);
+    SET_SER_INFO(s, SERIES_INFO_HAS_DYNAMIC);
+    SET_SER_INFO(s, SERIES_INFO_ARENA);
+
+    s->content.dynamic.data = cast(REBYTE*, s + 1);
+    s->content.dynamic.bias = 0;
+    s->content.dynamic.rest = capacity;
+    s->content.dynamic.len = 0;
+
+#if !defined(NDEBUG)
+    TRASH_POINTER_IF_DEBUG(s->guard);
+    TRASH_POINTER_IF_DEBUG(LINK(s).trash);
+    TRASH_POINTER_IF_DEBUG(MISC(s).trash);
+    s->tick = TG_Tick;
+#endif
+
+    return s;
+}
+
+
 //
 //  Alloc_Pairing: C
 //
@@ -1058,6 +1768,8 @@ REBVAL *Alloc_Pairing(REBFRM *opt_owning_frame) {
 void Manage_Pairing(REBVAL *paired) {
     REBVAL *key = PAIRING_KEY(paired);
     SET_VAL_FLAG(key, NODE_FLAG_MANAGED);
+
+    Note_Newly_Managed(NOD(key));
 }
 
 
@@ -1074,6 +1786,11 @@ void Unmanage_Pairing(REBVAL *paired) {
     REBVAL *key = PAIRING_KEY(paired);
     assert(GET_VAL_FLAG(key, NODE_FLAG_MANAGED));
     CLEAR_VAL_FLAG(key, NODE_FLAG_MANAGED);
+
+    // The generational GC leaves the mark on nodes that survived a recycle,
+    // but a marked unmanaged node would look corrupt to the sweep.
+    //
+    CLEAR_VAL_FLAG(key, NODE_FLAG_MARKED);
 }
 
 
@@ -1130,13 +1847,75 @@ static void Free_Unbiased_Series_Data(REBYTE *unbiased, REBCNT size_unpooled)
         alias->bits = FLAGBYTE_FIRST(FREED_SERIES_BYTE);
     }
     else {
-        FREE_N(REBYTE, size_unpooled, unbiased);
+    #ifdef MEM_MAP_SERIES
+        if (IS_MAPPED_SIZE(size_unpooled))
+            Unmap_Mem(unbiased, size_unpooled);
+        else
+    #endif
+            FREE_N(REBYTE, size_unpooled, unbiased);
         Mem_Pools[SYSTEM_POOL].has -= size_unpooled;
         Mem_Pools[SYSTEM_POOL].free++;
     }
 }
 
 
+#ifdef MEM_MAP_SERIES
+
+// Expand a non-array series whose data is mapped (see Map_Mem()) to hold at
+// least `length` units, opening a gap of `extra` bytes at byte `start`.  The
+// bias is taken out at the same time.  Returns FALSE if the mapping could
+// not be grown, in which case the series is left as it was.
+//
+static REBOOL Remap_Series_Data(
+    REBSER *s,
+    REBCNT length,
+    REBCNT start,
+    REBCNT extra
+){
+    REBYTE wide = SER_WIDE(s);
+    REBCNT bias = SER_BIAS(s);
+    REBCNT used = SER_LEN(s) * wide;
+    REBCNT size_old = Series_Allocation_Unpooled(s);
+
+    if (cast(REBU64, length) * wide > MAX_I32)
+        return FALSE;
+
+    // Round up to a power of 2 like Series_Data_Alloc(), so that appending
+    // repeatedly only remaps a logarithmic number of times.
+    //
+    REBCNT size = 2048;
+    while (size < length * wide)
+        size *= 2;
+
+    REBYTE *data = cast(REBYTE*, Remap_Mem(
+        s->content.dynamic.data - (wide * bias), size_old, size
+    ));
+    if (data == NULL)
+        return FALSE;
+
+    memmove(data, data + (wide * bias), start);
+    memmove(data + start + extra, data + (wide * bias) + start, used - start);
+
+    s->content.dynamic.data = data;
+    s->content.dynamic.bias = 0;
+    s->content.dynamic.rest = size / wide;
+
+    SET_SER_FLAG(s, SERIES_FLAG_POWER_OF_2);
+    if (size % wide == 0)
+        CLEAR_SER_FLAG(s, SERIES_FLAG_POWER_OF_2);
+
+    assert(Series_Allocation_Unpooled(s) == size);
+
+    Mem_Pools[SYSTEM_POOL].has += size - size_old;
+    if ((GC_Ballast -= size - size_old) <= 0)
+        SET_SIGNAL(SIG_RECYCLE);
+
+    return TRUE;
+}
+
+#endif
+
+
 //
 //  Expand_Series: C
 //
@@ -1311,6 +2090,26 @@ void Expand_Series(REBSER *s, REBCNT index, REBCNT delta)
     }
 #endif
 
+#ifdef MEM_MAP_SERIES
+    if (
+        was_dynamic
+        && NOT_SER_FLAG(s, SERIES_FLAG_ARRAY)
+        && IS_MAPPED_SIZE(Series_Allocation_Unpooled(s))
+        && Remap_Series_Data(s, len_old + delta + x, start, extra)
+    ){
+        if (n_found >= MAX_EXPAND_LIST)
+            Prior_Expand[n_available] = s;
+
+        s->content.dynamic.len = len_old + delta;
+        TERM_SERIES(s);
+
+    #if !defined(NDEBUG)
+        PG_Reb_Stats->Series_Expanded++;
+    #endif
+        return;
+    }
+#endif
+
     // !!! The protocol for doing new allocations currently mandates that the
     // dynamic content area be cleared out.  But the data lives in the content
     // area if there's no dynamic portion.  The in-REBSER content has to be
@@ -1362,6 +2161,11 @@ void Expand_Series(REBSER *s, REBCNT index, REBCNT delta)
 
     TERM_SERIES(s);
 
+    // Cells written into the old data since the last recycle dirtied cards
+    // that the new data isn't covered by.
+    //
+    Dirty_Series_Cards(s);
+
     if (was_dynamic) {
         //
         // We have to de-bias the data pointer before we can free it.
@@ -1374,7 +2178,12 @@ void Expand_Series(REBSER *s, REBCNT index, REBCNT delta)
     PG_Reb_Stats->Series_Expanded++;
 #endif
 
-    assert(NOT_SER_FLAG(s, NODE_FLAG_MARKED));
+    // Only survivors of a generational recycle (or nodes marked black during
+    // a sliced sweep) keep their mark between GCs
+    //
+    assert(
+        GC_Generational || GC_Sweeping || NOT_SER_FLAG(s, NODE_FLAG_MARKED)
+    );
 }
 
 
@@ -1423,6 +2232,9 @@ void Swap_Series_Content(REBSER* a, REBSER* b)
 
     SET_SERIES_LEN(a, b_len);
     SET_SERIES_LEN(b, a_len);
+
+    Dirty_Series_Cards(a); // an old array may get the content of a young one
+    Dirty_Series_Cards(b);
 }
 
 
@@ -1504,6 +2316,7 @@ void Remake_Series(REBSER *s, REBCNT units, REBYTE wide, REBUPT flags)
             data_old,
             s->content.dynamic.len * wide
         );
+        Dirty_Series_Cards(s); // see Expand_Series()
     } else
         s->content.dynamic.len = 0;
 
@@ -1532,6 +2345,12 @@ void GC_Kill_Series(REBSER *s)
     if (GET_SER_FLAG(s, SERIES_FLAG_UTF8_STRING))
         GC_Kill_Interning(s); // needs special handling to adjust canons
 
+    if (GET_SER_INFO(s, ARRAY_INFO_BYTECODE))
+        Free_Bytecode(ARR(s)); // compiled form of a function body
+
+    if (GET_SER_INFO(s, KEYLIST_INFO_INDEXED))
+        Free_Key_Index(ARR(s)); // hash index of an object's keys
+
     // Remove series from expansion list, if found:
     REBCNT n;
     for (n = 1; n < MAX_EXPAND_LIST; n++) {
@@ -1663,6 +2482,11 @@ void Free_Series(REBSER *s)
         printf("Trying to Free_Series() on a series managed by GC.\n");
         panic (s);
     }
+
+    if (GET_SER_INFO(s, SERIES_INFO_ARENA)) {
+        printf("Trying to Free_Series() on a series from Push_Arena()\n");
+        panic (s);
+    }
 #endif
 
     Drop_Manual_Series(s);
@@ -1761,11 +2585,18 @@ void Manage_Series(REBSER *s)
         printf("Attempt to manage already managed series\n");
         panic (s);
     }
+
+    if (GET_SER_INFO(s, SERIES_INFO_ARENA)) {
+        printf("Attempt to manage series from Push_Arena()\n");
+        panic (s);
+    }
 #endif
 
     s->header.bits |= NODE_FLAG_MANAGED;
 
     Drop_Manual_Series(s);
+
+    Note_Newly_Managed(NOD(s));
 }
 
 
@@ -2095,7 +2926,7 @@ REBCNT Check_Memory_Debug(void)
         REBSER *s = cast(REBSER*, seg + 1);
 
         REBCNT n;
-        for (n = Mem_Pools[SER_POOL].units; n > 0; --n, ++s) {
+        for (n = SEG_UNITS(&Mem_Pools[SER_POOL], seg); n > 0; --n, ++s) {
             if (IS_FREE_NODE(s))
                 continue;
 
@@ -2182,7 +3013,7 @@ void Dump_All_Series_Of_Size(REBCNT size)
     for (seg = Mem_Pools[SER_POOL].segs; seg; seg = seg->next) {
         REBSER *s = cast(REBSER*, seg + 1);
         REBCNT n;
-        for (n = Mem_Pools[SER_POOL].units; n > 0; --n, ++s) {
+        for (n = SEG_UNITS(&Mem_Pools[SER_POOL], seg); n > 0; --n, ++s) {
             if (IS_FREE_NODE(s))
                 continue;
 
@@ -2212,7 +3043,7 @@ void Dump_Series_In_Pool(REBCNT pool_id)
     for (seg = Mem_Pools[SER_POOL].segs; seg; seg = seg->next) {
         REBSER *s = cast(REBSER*, seg + 1);
         REBCNT n = 0;
-        for (n = Mem_Pools[SER_POOL].units; n > 0; --n, ++s) {
+        for (n = SEG_UNITS(&Mem_Pools[SER_POOL], seg); n > 0; --n, ++s) {
             if (IS_FREE_NODE(s))
                 continue;
 
@@ -2320,7 +3151,7 @@ REBU64 Inspect_Series(REBOOL show)
         REBSER *s = cast(REBSER*, seg + 1);
 
         REBCNT n;
-        for (n = Mem_Pools[SER_POOL].units; n > 0; n--) {
+        for (n = SEG_UNITS(&Mem_Pools[SER_POOL], seg); n > 0; n--) {
             if (IS_FREE_NODE(s)) {
                 ++fre;
                 continue;
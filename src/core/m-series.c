@@ -70,6 +70,11 @@ REBCNT Insert_Series(
         data,
         SER_WIDE(s) * len
     );
+    if (GET_SER_FLAG(s, SERIES_FLAG_ARRAY)) // see GC_Barrier_Write()
+        Dirty_Cards(
+            SER_DATA_RAW(s) + (SER_WIDE(s) * index),
+            SER_WIDE(s) * len
+        );
 
     return index + len;
 }
@@ -114,6 +119,7 @@ void Append_Values_Len(REBARR *a, const REBVAL head[], REBCNT len)
     EXPAND_SERIES_TAIL(SER(a), len);
 
     memcpy(ARR_AT(a, old_len), head, sizeof(REBVAL) * len);
+    Dirty_Cards(ARR_AT(a, old_len), sizeof(REBVAL) * len);
 
     TERM_ARRAY_LEN(a, ARR_LEN(a));
 }
@@ -294,8 +294,20 @@ REBCTX *Context_For_Frame_May_Reify_Managed(REBFRM *f)
         return CTX(f->varlist);
     }
 
-    f->varlist = Alloc_Singular_Array_Core(ARRAY_FLAG_VARLIST);
-    SET_SER_INFO(f->varlist, CONTEXT_INFO_STACK); // NOT a SER_FLAG!
+    // Varlists of earlier frames that the GC found unreachable are kept
+    // for reuse, which saves allocating a node (and charging the ballast for
+    // it) on every call that needs one.  See Cache_Dead_Varlist().
+    //
+    REBOOL cached = LOGICAL(GC_Varlist_Cache != NULL);
+    if (cached) {
+        f->varlist = GC_Varlist_Cache;
+        GC_Varlist_Cache = cast(REBARR*, LINK(f->varlist).keysource);
+        assert(GET_SER_INFO(f->varlist, CONTEXT_INFO_STACK));
+    }
+    else {
+        f->varlist = Alloc_Singular_Array_Core(ARRAY_FLAG_VARLIST);
+        SET_SER_INFO(f->varlist, CONTEXT_INFO_STACK); // NOT a SER_FLAG!
+    }
     MISC(f->varlist).meta = NULL; // seen by GC, must initialize
 
     // When running a function frame, the arglist will be marked safe from
@@ -326,7 +338,15 @@ REBCTX *Context_For_Frame_May_Reify_Managed(REBFRM *f)
 
     REBCTX *c = CTX(f->varlist);
     ASSERT_ARRAY_MANAGED(CTX_KEYLIST(c));
-    MANAGE_ARRAY(f->varlist);
+    if (cached) {
+        //
+        // Never went back in GC_Manuals, so Manage_Series() can't be used.
+        //
+        SET_SER_FLAG(f->varlist, NODE_FLAG_MANAGED);
+        Note_Newly_Managed(NOD(f->varlist));
+    }
+    else
+        MANAGE_ARRAY(f->varlist);
 
     ASSERT_CONTEXT(c);
     assert(NOT(CTX_VARS_UNAVAILABLE(c)));
@@ -745,7 +745,9 @@ REBNATIVE(hijack)
         // directly.  This is a reasonably common case, and especially
         // common when putting the originally hijacked function back.
 
+        GC_Barrier_Write(victim_paramlist);
         LINK(victim_paramlist).facade = LINK(hijacker_paramlist).facade;
+        GC_Barrier_Write(victim->payload.function.body_holder);
         LINK(victim->payload.function.body_holder).exemplar =
             LINK(hijacker->payload.function.body_holder).exemplar;
 
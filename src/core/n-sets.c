@@ -126,9 +126,9 @@ REBSER *Make_Set_Operation_Series(
                         VAL_SPECIFIER(val1),
                         skip,
                         cased,
-                        1
+                        0
                     );
-                    h = (h >= 0);
+                    h = (h != 0);
                     if (flags & SOP_FLAG_INVERT) h = !h;
                 }
                 if (h) {
@@ -139,7 +139,7 @@ REBSER *Make_Set_Operation_Series(
                         VAL_SPECIFIER(val1),
                         skip,
                         cased,
-                        2
+                        1
                     );
                 }
             }
@@ -128,6 +128,17 @@ REBNATIVE(exit_rebol)
 //          "Monitor recycling (debug only)"
 //      /verbose
 //          "Dump out information about series being recycled (debug only)"
+//      /generational
+//          "Set whether auto-recycles usually only check new series"
+//      enable [logic!]
+//      /incremental
+//          "Auto-recycles sweep in slices of at most this long (0 for off)"
+//      budget [time!]
+//      /slack
+//          "Spare pool memory recycles keep, as a percent of memory in use"
+//      percent [integer!]
+//      /compact
+//          "Move series data out of sparse pools (see COMPACTED in STATS/GC)"
 //  ]
 //
 REBNATIVE(recycle)
@@ -154,6 +165,22 @@ REBNATIVE(recycle)
         VAL_INT64(TASK_BALLAST) = 0;
     }
 
+    if (REF(generational))
+        Set_GC_Generational(VAL_LOGIC(ARG(enable)));
+
+    if (REF(incremental)) {
+        REBI64 usecs = VAL_NANO(ARG(budget)) / 1000;
+        if (usecs < 0 || usecs > MAX_I32)
+            fail (Error_Out_Of_Range(ARG(budget)));
+        GC_Pause_Budget = cast(REBCNT, usecs);
+    }
+
+    if (REF(slack)) {
+        if (VAL_INT64(ARG(percent)) < 0 || VAL_INT64(ARG(percent)) > MAX_I32)
+            fail (Error_Out_Of_Range(ARG(percent)));
+        GC_Pool_Slack = VAL_INT32(ARG(percent));
+    }
+
     if (GC_Disabled)
         return R_VOID; // don't give back misleading "0", since no recycle ran
 
@@ -180,9 +207,18 @@ REBNATIVE(recycle)
     #endif
     }
     else {
-        count = Recycle();
+        // An explicit RECYCLE is always a full one, even in generational
+        // mode (where Recycle() would usually only look at the nursery).
+        //
+        count = Recycle_Core(FALSE, NULL);
     }
 
+    // The bytes this gives back are totaled in GC_Compacted, which STATS/GC
+    // reports as `compacted` (the result of RECYCLE stays the series count).
+    //
+    if (REF(compact))
+        Compact_Series_Data();
+
     if (REF(watch)) {
     #if defined(NDEBUG)
         fail (Error_Debug_Only_Raw());
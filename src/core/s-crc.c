@@ -174,6 +174,199 @@ static u32 *crc32_table = 0;
 static void Make_CRC32_Table(void);
 
 
+// Hash_Value() of strings and binaries is seeded with a value picked at
+// random when the process starts.  So someone who can choose the keys going
+// into a MAP! (e.g. from a web request) can't work out a set of keys that
+// all collide into long probe chains ahead of time.
+//
+// The hashing itself follows MurmurHash3's 64-bit variant: mix in a word of
+// data at a time, then avalanche the bits at the end.
+//
+static REBU64 Hash_Seed;
+
+inline static REBU64 Rotl64(REBU64 x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+inline static REBU64 Hash_Step(REBU64 h, REBU64 k) {
+    k *= 0x87C37B91114253D5ULL;
+    k = Rotl64(k, 31);
+    k *= 0x4CF5AD432745937FULL;
+    h ^= k;
+    h = Rotl64(h, 27);
+    return h * 5 + 0x52DCE729;
+}
+
+inline static REBCNT Hash_Finish(REBU64 h, REBCNT len) {
+    h ^= len;
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDULL;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ULL;
+    h ^= h >> 33;
+    return cast(REBCNT, h);
+}
+
+
+//
+//  Hash_Bytes: C
+//
+// Case-sensitive hash of binary data, taken 8 bytes at a time.
+//
+static REBCNT Hash_Bytes(const REBYTE *data, REBCNT len)
+{
+    REBU64 h = Hash_Seed;
+    REBCNT n = len;
+
+    for (; n >= 8; n -= 8, data += 8) {
+        REBU64 k;
+        memcpy(&k, data, 8);
+        h = Hash_Step(h, k);
+    }
+
+    if (n != 0) {
+        REBU64 k = 0;
+        REBCNT i;
+        for (i = 0; i < n; ++i)
+            k |= cast(REBU64, data[i]) << (i * 8);
+        h = Hash_Step(h, k);
+    }
+
+    return Hash_Finish(h, len);
+}
+
+
+// Four characters are hashed at a time, as 16-bit lanes of a 64-bit word.
+// Building the word the same way from byte-sized and REBUNI-sized strings
+// gives the same hash for the same characters, as lax equality requires.
+//
+#define LANES_OF(c) \
+    (cast(REBU64, (c)) * 0x0001000100010001ULL)
+
+inline static REBU64 Lower_Case_Lanes(REBU64 k) {
+    if ((k & LANES_OF(0xFF80)) == 0) {
+        //
+        // All ASCII, so the lanes can be folded together.  A lane gets its
+        // 0x80 bit set by the first add if it's 'A' or above, and by the
+        // second if it's above 'Z'...leaving just the uppercase letters,
+        // which get 0x20 added.
+        //
+        REBU64 upper = (k + LANES_OF(0x80 - 'A'))
+            & ~(k + LANES_OF(0x80 - 'Z' - 1))
+            & LANES_OF(0x80);
+        return k | (upper >> 2);
+    }
+
+    REBU64 out = 0;
+    int shift;
+    for (shift = 0; shift < 64; shift += 16) {
+        REBUNI c = cast(REBUNI, k >> shift);
+        if (c < UNICODE_CASES)
+            c = LO_CASE(c);
+        out |= cast(REBU64, c) << shift;
+    }
+    return out;
+}
+
+
+//
+//  Hash_Chars_Caseless: C
+//
+// Case-insensitive hash of the characters of a byte-sized or REBUNI string.
+//
+static REBCNT Hash_Chars_Caseless(const void *data, REBCNT len, REBCNT wide)
+{
+    REBU64 h = Hash_Seed;
+
+    const REBYTE *b = cast(const REBYTE*, data);
+    const REBUNI *u = cast(const REBUNI*, data);
+
+    REBCNT i = 0;
+    while (i < len) {
+        REBU64 k = 0;
+        int shift;
+        if (wide == 1) {
+            for (shift = 0; shift < 64 && i < len; shift += 16, ++i)
+                k |= cast(REBU64, b[i]) << shift;
+        }
+        else {
+            assert(wide == 2);
+            for (shift = 0; shift < 64 && i < len; shift += 16, ++i)
+                k |= cast(REBU64, u[i]) << shift;
+        }
+        h = Hash_Step(h, Lower_Case_Lanes(k));
+    }
+
+    return Hash_Finish(h, len);
+}
+
+
+//
+//  Hash_Array: C
+//
+// A hash of an array's items which is consistent with Cmp_Array()'s lax
+// equality.  Numbers are hashed by value alone, since `[1] = [1.0]`.  Nested
+// arrays only count for their type and length, which keeps the time linear
+// (and cycles are no problem).  Items of types Hash_Value() can't handle
+// only count for their type.
+//
+static REBCNT Hash_Array(const RELVAL *v)
+{
+    REBU64 h = Hash_Seed;
+
+    const RELVAL *item = VAL_ARRAY_AT(v);
+    for (; NOT_END(item); ++item) {
+        REBU64 k;
+        switch (VAL_TYPE(item)) {
+        case REB_INTEGER:
+            k = cast(REBU64, VAL_INT64(item));
+            break;
+
+        case REB_DECIMAL:
+        case REB_PERCENT: {
+            REBDEC d = VAL_DECIMAL(item);
+            if (
+                d > -9.2e18 && d < 9.2e18
+                && d == cast(REBDEC, cast(REBI64, d))
+            ){
+                k = cast(REBU64, cast(REBI64, d)); // same as the INTEGER!
+            }
+            else
+                k = cast(REBU64, VAL_INT64(item)); // shares the bits
+            break; }
+
+        case REB_BLOCK:
+        case REB_GROUP:
+        case REB_PATH:
+        case REB_SET_PATH:
+        case REB_GET_PATH:
+        case REB_LIT_PATH:
+            k = VAL_TYPE(item) | (cast(REBU64, VAL_LEN_AT(item)) << 8);
+            break;
+
+        case REB_BITSET:
+        case REB_IMAGE:
+        case REB_VECTOR:
+        case REB_TYPESET:
+        case REB_GOB:
+        case REB_EVENT:
+        case REB_HANDLE:
+        case REB_STRUCT:
+        case REB_LIBRARY:
+            k = VAL_TYPE(item);
+            break;
+
+        default:
+            k = Hash_Value(item);
+            break;
+        }
+        h = Hash_Step(h, k);
+    }
+
+    return Hash_Finish(h, VAL_LEN_AT(v));
+}
+
+
 //
 //  Hash_Value: C
 //
@@ -245,14 +438,17 @@ REBCNT Hash_Value(const RELVAL *v)
         break;
 
     case REB_BINARY:
+        ret = Hash_Bytes(VAL_BIN_AT(v), VAL_LEN_AT(v));
+        break;
+
     case REB_STRING:
     case REB_FILE:
     case REB_EMAIL:
     case REB_URL:
     case REB_TAG:
-        ret = Hash_String(
+        ret = Hash_Chars_Caseless(
             VAL_RAW_DATA_AT(v),
-            VAL_LEN_HEAD(v),
+            VAL_LEN_AT(v),
             SER_WIDE(VAL_SERIES(v))
         );
         break;
@@ -263,20 +459,12 @@ REBCNT Hash_Value(const RELVAL *v)
     case REB_SET_PATH:
     case REB_GET_PATH:
     case REB_LIT_PATH:
-        //
-        // !!! Lame hash just to get it working.  There will be lots of
-        // collisions.  Intentionally bad to avoid writing something that
-        // is less obviously not thought out.
-        //
-        // Whatever hash is used must be able to match lax equality.  So it
-        // could hash all the values case-insensitively, or the first N values,
-        // or something.
         //
         // Note that if there is a way to mutate this array, there will be
         // problems.  Do not hash mutable arrays unless you are sure hashings
         // won't cross a mutation.
         //
-        ret = ARR_LEN(VAL_ARRAY(v));
+        ret = Hash_Array(v);
         break;
 
     case REB_DATATYPE: {
@@ -379,15 +567,18 @@ REBCNT Hash_Value(const RELVAL *v)
 //
 REBSER *Make_Hash_Sequence(REBCNT len)
 {
-    REBCNT n = Get_Hash_Prime(len * 2); // best when 2X # of keys
-    if (n == 0) {
-        DECLARE_LOCAL (temp);
-        Init_Integer(temp, len);
+    REBCNT n = 8;
+    while (n < len * 2) { // best when 2X # of keys
+        if (n >= (1u << 30)) {
+            DECLARE_LOCAL (temp);
+            Init_Integer(temp, len);
 
-        fail (Error_Size_Limit_Raw(temp));
+            fail (Error_Size_Limit_Raw(temp));
+        }
+        n *= 2;
     }
 
-    REBSER *ser = Make_Series(n + 1, sizeof(REBCNT));
+    REBSER *ser = Make_Series(n + 1, sizeof(struct Reb_Hash_Slot));
     Clear_Series(ser);
     SET_SERIES_LEN(ser, n);
 
@@ -426,28 +617,22 @@ void Init_Map(REBVAL *out, REBMAP *map)
 //
 REBSER *Hash_Block(const REBVAL *block, REBCNT skip, REBOOL cased)
 {
-    REBCNT n;
-    REBSER *hashlist;
-    REBCNT *hashes;
-    REBARR *array = VAL_ARRAY(block);
-    RELVAL *value;
+    // Lookups only ask whether a key is in the block, so there's no need to
+    // check for duplicates (or be `cased`) when adding the keys.
+    //
+    UNUSED(cased);
 
-    // Create the hash array (integer indexes):
-    hashlist = Make_Hash_Sequence(VAL_LEN_AT(block));
-    hashes = SER_HEAD(REBCNT, hashlist);
+    REBSER *hashlist = Make_Hash_Sequence(VAL_LEN_AT(block));
 
-    value = VAL_ARRAY_AT(block);
+    RELVAL *value = VAL_ARRAY_AT(block);
     if (IS_END(value))
         return hashlist;
 
-    n = VAL_INDEX(block);
+    REBCNT n = VAL_INDEX(block);
     while (TRUE) {
         REBCNT skip_index = skip;
 
-        REBCNT hash = Find_Key_Hashed(
-            array, hashlist, value, VAL_SPECIFIER(block), 1, cased, 0
-        );
-        hashes[hash] = (n / skip) + 1;
+        Add_Key_Hashed(hashlist, value, (n / skip) + 1);
 
         while (skip_index != 0) {
             value++;
@@ -601,6 +786,16 @@ void Startup_CRC(void)
     Make_CRC_Table(PRZCRC);
 
     Make_CRC32_Table();
+
+    // The clock and the addresses of a stack variable and a global (which
+    // vary with address space layout randomization) are unpredictable
+    // enough to seed hashes with.  Run them through the hash's mixing so
+    // every bit of the seed depends on all of them.
+    //
+    REBU64 seed = cast(REBU64, OS_DELTA_TIME(0));
+    seed = Hash_Step(seed, cast(REBU64, cast(REBUPT, &seed)));
+    seed = Hash_Step(seed, cast(REBU64, cast(REBUPT, &Hash_Seed)));
+    Hash_Seed = Hash_Step(seed, 0);
 }
 
 
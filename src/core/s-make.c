@@ -239,15 +239,20 @@ cp_same:
 
 
 //
-//  Copy_String_Slimming: C
+//  Copy_String_Slimming_Core: C
 //
 // Copies a portion of any string (byte or unicode).  If the input is a
 // wide REBUNI string, the range of copied characters will be examined to
 // see if they could fit in a byte-size series.  The string will be
-// "slimmed" if possible.
+// "slimmed" if possible.  If `arena` is TRUE, the copy is made with
+// Make_Arena_Series(), see Push_Arena().
 //
-REBSER *Copy_String_Slimming(REBSER *src, REBCNT index, REBINT length)
-{
+REBSER *Copy_String_Slimming_Core(
+    REBSER *src,
+    REBCNT index,
+    REBINT length,
+    REBOOL arena
+){
     REBYTE wide = 1;
 
     if (length < 0)
@@ -266,7 +271,9 @@ REBSER *Copy_String_Slimming(REBSER *src, REBCNT index, REBINT length)
             wide = sizeof(REBUNI);
     }
 
-    REBSER *dst = Make_Series(length + 1, wide);
+    REBSER *dst = arena
+        ? Make_Arena_Series(length + 1, wide)
+        : Make_Series(length + 1, wide);
     Insert_String(dst, 0, src, index, length, TRUE);
     TERM_SEQUENCE_LEN(dst, length);
 
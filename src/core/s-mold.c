@@ -808,9 +808,10 @@ void Throttle_Mold(REB_MOLD *mo) {
 //
 // If len is END_FLAG then all the string content will be copied, otherwise
 // it will be copied up to `len`.  If there are not enough characters then
-// the debug build will assert.
+// the debug build will assert.  If `arena` is TRUE, the string is made with
+// Make_Arena_Series(), see Push_Arena().
 //
-REBSER *Pop_Molded_String_Core(REB_MOLD *mo, REBCNT len)
+REBSER *Pop_Molded_String_Core(REB_MOLD *mo, REBCNT len, REBOOL arena)
 {
     assert(mo->series); // if NULL there was no Push_Mold()
 
@@ -824,12 +825,13 @@ REBSER *Pop_Molded_String_Core(REB_MOLD *mo, REBCNT len)
     // The copy process looks at the characters in range and will make a
     // BYTE_SIZE() target string out of the REBUNIs if possible...
     //
-    REBSER *result = Copy_String_Slimming(
+    REBSER *result = Copy_String_Slimming_Core(
         mo->series,
         mo->start,
         (len == UNKNOWN)
             ? SER_LEN(mo->series) - mo->start
-            : len
+            : len,
+        arena
     );
 
     // Though the protocol of Mold_Value does terminate, it only does so if
@@ -555,3 +555,83 @@ setDec:
 
     return R_OUT;
 }
+
+
+//
+// Typed entries for DECIMAL! op DECIMAL!, see Register_Typed_Entry().  Like
+// setDec in REBTYPE(Decimal), math results that aren't finite are errors.
+// Equality goes through CT_Decimal() for its tolerance.
+//
+
+static REB_R Finite_Decimal_Out(REBFRM *frame_, REBDEC d) {
+    if (!FINITE(d))
+        fail (Error_Overflow_Raw());
+    Init_Decimal(D_OUT, d);
+    return R_OUT;
+}
+
+static REB_R Add_Decimals(REBFRM *frame_) {
+    return Finite_Decimal_Out(
+        frame_, VAL_DECIMAL(D_ARG(1)) + VAL_DECIMAL(D_ARG(2))
+    );
+}
+
+static REB_R Subtract_Decimals(REBFRM *frame_) {
+    return Finite_Decimal_Out(
+        frame_, VAL_DECIMAL(D_ARG(1)) - VAL_DECIMAL(D_ARG(2))
+    );
+}
+
+static REB_R Multiply_Decimals(REBFRM *frame_) {
+    return Finite_Decimal_Out(
+        frame_, VAL_DECIMAL(D_ARG(1)) * VAL_DECIMAL(D_ARG(2))
+    );
+}
+
+static REB_R Equal_Decimals(REBFRM *frame_) {
+    return CT_Decimal(D_ARG(1), D_ARG(2), 0) ? R_TRUE : R_FALSE;
+}
+
+static REB_R Not_Equal_Decimals(REBFRM *frame_) {
+    return CT_Decimal(D_ARG(1), D_ARG(2), 0) ? R_FALSE : R_TRUE;
+}
+
+static REB_R Lesser_Decimals(REBFRM *frame_) {
+    return CT_Decimal(D_ARG(1), D_ARG(2), -1) ? R_FALSE : R_TRUE;
+}
+
+static REB_R Lesser_Or_Equal_Decimals(REBFRM *frame_) {
+    return CT_Decimal(D_ARG(1), D_ARG(2), -2) ? R_FALSE : R_TRUE;
+}
+
+static REB_R Greater_Decimals(REBFRM *frame_) {
+    return CT_Decimal(D_ARG(1), D_ARG(2), -2) ? R_TRUE : R_FALSE;
+}
+
+static REB_R Greater_Or_Equal_Decimals(REBFRM *frame_) {
+    return CT_Decimal(D_ARG(1), D_ARG(2), -1) ? R_TRUE : R_FALSE;
+}
+
+
+//
+//  Startup_Decimal_Entries: C
+//
+void Startup_Decimal_Entries(void)
+{
+    const enum Reb_Kind k = REB_DECIMAL;
+
+    Register_Typed_Entry(Lib_Function(SYM_ADD), k, k, &Add_Decimals);
+    Register_Typed_Entry(Lib_Function(SYM_SUBTRACT), k, k, &Subtract_Decimals);
+    Register_Typed_Entry(Lib_Function(SYM_MULTIPLY), k, k, &Multiply_Decimals);
+
+    Register_Typed_Entry(NAT_FUNC(equal_q), k, k, &Equal_Decimals);
+    Register_Typed_Entry(NAT_FUNC(not_equal_q), k, k, &Not_Equal_Decimals);
+    Register_Typed_Entry(NAT_FUNC(lesser_q), k, k, &Lesser_Decimals);
+    Register_Typed_Entry(
+        NAT_FUNC(lesser_or_equal_q), k, k, &Lesser_Or_Equal_Decimals
+    );
+    Register_Typed_Entry(NAT_FUNC(greater_q), k, k, &Greater_Decimals);
+    Register_Typed_Entry(
+        NAT_FUNC(greater_or_equal_q), k, k, &Greater_Or_Equal_Decimals
+    );
+}
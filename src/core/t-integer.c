@@ -591,3 +591,82 @@ REBTYPE(Integer)
     Init_Integer(D_OUT, num);
     return R_OUT;
 }
+
+
+//
+// Typed entries for INTEGER! op INTEGER!, see Register_Typed_Entry().  These
+// skip the Value_Dispatch[] and argument shuffling of REBTYPE(Integer) and
+// Compare_Modify_Values(), but must still check for overflow.
+//
+
+static REB_R Add_Integers(REBFRM *frame_) {
+    REBI64 sum;
+    if (REB_I64_ADD_OF(VAL_INT64(D_ARG(1)), VAL_INT64(D_ARG(2)), &sum))
+        fail (Error_Overflow_Raw());
+    Init_Integer(D_OUT, sum);
+    return R_OUT;
+}
+
+static REB_R Subtract_Integers(REBFRM *frame_) {
+    REBI64 diff;
+    if (REB_I64_SUB_OF(VAL_INT64(D_ARG(1)), VAL_INT64(D_ARG(2)), &diff))
+        fail (Error_Overflow_Raw());
+    Init_Integer(D_OUT, diff);
+    return R_OUT;
+}
+
+static REB_R Multiply_Integers(REBFRM *frame_) {
+    REBI64 product;
+    if (REB_I64_MUL_OF(VAL_INT64(D_ARG(1)), VAL_INT64(D_ARG(2)), &product))
+        fail (Error_Overflow_Raw());
+    Init_Integer(D_OUT, product);
+    return R_OUT;
+}
+
+static REB_R Equal_Integers(REBFRM *frame_) {
+    return VAL_INT64(D_ARG(1)) == VAL_INT64(D_ARG(2)) ? R_TRUE : R_FALSE;
+}
+
+static REB_R Not_Equal_Integers(REBFRM *frame_) {
+    return VAL_INT64(D_ARG(1)) != VAL_INT64(D_ARG(2)) ? R_TRUE : R_FALSE;
+}
+
+static REB_R Lesser_Integers(REBFRM *frame_) {
+    return VAL_INT64(D_ARG(1)) < VAL_INT64(D_ARG(2)) ? R_TRUE : R_FALSE;
+}
+
+static REB_R Lesser_Or_Equal_Integers(REBFRM *frame_) {
+    return VAL_INT64(D_ARG(1)) <= VAL_INT64(D_ARG(2)) ? R_TRUE : R_FALSE;
+}
+
+static REB_R Greater_Integers(REBFRM *frame_) {
+    return VAL_INT64(D_ARG(1)) > VAL_INT64(D_ARG(2)) ? R_TRUE : R_FALSE;
+}
+
+static REB_R Greater_Or_Equal_Integers(REBFRM *frame_) {
+    return VAL_INT64(D_ARG(1)) >= VAL_INT64(D_ARG(2)) ? R_TRUE : R_FALSE;
+}
+
+
+//
+//  Startup_Integer_Entries: C
+//
+void Startup_Integer_Entries(void)
+{
+    const enum Reb_Kind k = REB_INTEGER;
+
+    Register_Typed_Entry(Lib_Function(SYM_ADD), k, k, &Add_Integers);
+    Register_Typed_Entry(Lib_Function(SYM_SUBTRACT), k, k, &Subtract_Integers);
+    Register_Typed_Entry(Lib_Function(SYM_MULTIPLY), k, k, &Multiply_Integers);
+
+    Register_Typed_Entry(NAT_FUNC(equal_q), k, k, &Equal_Integers);
+    Register_Typed_Entry(NAT_FUNC(not_equal_q), k, k, &Not_Equal_Integers);
+    Register_Typed_Entry(NAT_FUNC(lesser_q), k, k, &Lesser_Integers);
+    Register_Typed_Entry(
+        NAT_FUNC(lesser_or_equal_q), k, k, &Lesser_Or_Equal_Integers
+    );
+    Register_Typed_Entry(NAT_FUNC(greater_q), k, k, &Greater_Integers);
+    Register_Typed_Entry(
+        NAT_FUNC(greater_or_equal_q), k, k, &Greater_Or_Equal_Integers
+    );
+}
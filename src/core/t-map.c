@@ -58,20 +58,169 @@ REBMAP *Make_Map(REBCNT capacity)
 }
 
 
+// Only the bits of a hash under the `mask` of the hashlist pick its slot, and
+// Hash_Value() can leave those poorly spread (e.g. for integer keys that are
+// all multiples of 1024).  So the bits above the mask are mixed and XOR'd in.
+// Bits under the mask are left as they are: hashes smaller than the table
+// (like those of a run of integers, which are the integers themselves) keep
+// their own slots, so runs of keys fill runs of slots with no collisions and
+// are looked up in cache-friendly order.  A full mix of all the bits would
+// scatter them.  The mixing is reversible, so two mixed hashes are equal
+// only if the hashes they came from are.
+//
+inline static REBCNT Mix_Hash(REBCNT hash, REBCNT mask) {
+    REBU64 high = cast(REBU64, hash & ~mask) * U64_C(0x9E3779B97F4A7C15);
+    return hash ^ (cast(REBCNT, high >> 32) & mask);
+}
+
+
+//
+//  Find_Hashed_Core: C
+//
+// Search the hashlist for the record whose key matches `key`, whose hash is
+// already known.  Returns the 1-based record number, or 0 if not found.
+//
+// If not `cased`, an exact match is preferred but a match differing only in
+// case will be returned if there isn't one.
+//
+static REBCNT Find_Hashed_Core(
+    REBARR *array,
+    REBSER *hashlist,
+    const RELVAL *key,
+    REBCNT hash,
+    REBCNT wide,
+    REBOOL cased
+){
+    struct Reb_Hash_Slot *slots = SER_HEAD(struct Reb_Hash_Slot, hashlist);
+    REBCNT mask = SER_LEN(hashlist) - 1;
+
+    REBCNT uncased = 0; // uncased match not yet encountered
+
+    hash = Mix_Hash(hash, mask);
+
+    REBCNT i = hash & mask;
+    REBCNT dist = 0; // how far `i` is from the home slot of the hash
+    for (; slots[i].n != 0; i = (i + 1) & mask, ++dist) {
+        if (((i - slots[i].hash) & mask) < dist)
+            break; // would have displaced this key if it were in the table
+
+        if (slots[i].hash != hash)
+            continue;
+
+        REBCNT n = slots[i].n;
+        if (n == REMOVED_SLOT)
+            continue; // tombstone of a removed key, see %sys-map.h
+
+        const RELVAL *val = ARR_AT(array, (n - 1) * wide);
+
+        if (ANY_WORD(key)) {
+            if (NOT(ANY_WORD(val)))
+                continue;
+            if (VAL_WORD_SPELLING(key) == VAL_WORD_SPELLING(val))
+                return n; // exact match
+            if (NOT(cased) && uncased == 0)
+                if (VAL_WORD_CANON(key) == VAL_WORD_CANON(val))
+                    uncased = n;
+        }
+        else if (VAL_TYPE(val) != VAL_TYPE(key))
+            continue;
+        else if (ANY_BINSTR(key)) {
+            if (0 == Compare_String_Vals(val, key, FALSE))
+                return n;
+            if (
+                NOT(cased) && uncased == 0
+                && 0 == Compare_String_Vals(val, key, LOGICAL(!IS_BINARY(key)))
+            ){
+                uncased = n;
+            }
+        }
+        else {
+            if (0 == Cmp_Value(key, val, TRUE))
+                return n;
+            if (
+                NOT(cased) && uncased == 0
+                && REB_CHAR == VAL_TYPE(val)
+                && 0 == Cmp_Value(key, val, FALSE)
+            ){
+                uncased = n;
+            }
+        }
+    }
+
+    return cased ? 0 : uncased;
+}
+
+
+//
+//  Add_Hashed_Core: C
+//
+// Put record number `n`, whose key has the given hash, into the hashlist.
+// There must be a free slot.  It doesn't check if the key is already there.
+// A tombstone is taken over by the first key (the one being added, or one
+// that it displaced) which reaches it no closer to home than it was.
+//
+static void Add_Hashed_Core(REBSER *hashlist, REBCNT hash, REBCNT n)
+{
+    struct Reb_Hash_Slot *slots = SER_HEAD(struct Reb_Hash_Slot, hashlist);
+    REBCNT mask = SER_LEN(hashlist) - 1;
+
+    hash = Mix_Hash(hash, mask);
+
+    struct Reb_Hash_Slot add;
+    add.n = n;
+    add.hash = hash;
+
+    REBCNT i = hash & mask;
+    REBCNT dist = 0;
+    for (; slots[i].n != 0; i = (i + 1) & mask, ++dist) {
+        REBCNT slot_dist = (i - slots[i].hash) & mask;
+        if (slot_dist > dist)
+            continue;
+        if (slots[i].n == REMOVED_SLOT)
+            break; // the tombstone's key is gone, so nothing is displaced
+        if (slot_dist < dist) { // take from the rich, give to the poor
+            struct Reb_Hash_Slot temp = slots[i];
+            slots[i] = add;
+            add = temp;
+            dist = slot_dist;
+        }
+    }
+    slots[i] = add;
+}
+
+
+//
+//  Remove_Hashed_Core: C
+//
+// Make the slot of record number `n`, whose key has the given hash, into a
+// tombstone (see %sys-map.h).
+//
+static void Remove_Hashed_Core(REBSER *hashlist, REBCNT hash, REBCNT n)
+{
+    struct Reb_Hash_Slot *slots = SER_HEAD(struct Reb_Hash_Slot, hashlist);
+    REBCNT mask = SER_LEN(hashlist) - 1;
+
+    REBCNT i = Mix_Hash(hash, mask) & mask;
+    for (; slots[i].n != n; i = (i + 1) & mask)
+        assert(slots[i].n != 0);
+
+    slots[i].n = REMOVED_SLOT;
+}
+
+
 //
 //  Find_Key_Hashed: C
 //
-// Returns hash index (either the match or the new one).
-// A return of zero is valid (as a hash index);
+// Returns the 1-based number of the record whose key matches, or 0 if none.
 //
 // Wide: width of record (normally 2, a key and a value).
 //
 // Modes:
-//     0 - search, return hash if found or not
-//     1 - search, return hash, else return -1 if not
-//     2 - search, return hash, else append value and return -1
+//     0 - search only
+//     1 - search, and if not found append the key as a new record--along
+//         with the `wide - 1` values that follow it--and add it to the hash
 //
-REBINT Find_Key_Hashed(
+REBCNT Find_Key_Hashed(
     REBARR *array,
     REBSER *hashlist,
     const RELVAL *key, // !!! assumes key is followed by value(s) via ++
@@ -80,128 +229,45 @@ REBINT Find_Key_Hashed(
     REBOOL cased,
     REBYTE mode
 ) {
-    REBCNT len = SER_LEN(hashlist);
-    assert(len > 0);
-
     REBCNT hash = Hash_Value(key);
 
-    // The REBCNT[] hash array size is chosen to try and make a large enough
-    // table relative to the data that collisions will be hopefully not
-    // frequent.  But they may still collide.  The method R3-Alpha chose to
-    // deal with collisions was to have a "skip" amount that will go try
-    // another hash bucket until the searched for key is found or a 0
-    // entry in the hashlist is found.
-    //
-    // Note: if len and skip are co-primes is guaranteed that repeatedly
-    // adding skip (and subtracting len when needed) all positions are
-    // visited.  1 <= skip < len, and len is prime, so this is guaranteed.
-
-    REBCNT skip = hash % (len - 1) + 1;
+    REBCNT n = Find_Hashed_Core(array, hashlist, key, hash, wide, cased);
+    if (n != 0 || mode == 0)
+        return n;
 
-    hash = hash % len;
+    assert(ARR_LEN(array) / wide < SER_LEN(hashlist));
+    Add_Hashed_Core(hashlist, hash, ARR_LEN(array) / wide + 1);
 
-    // a 'zombie' is a key with void value, that may be overwritten.  Set to
-    // len to indicate zombie not yet encountered.
+    // This used to use Append_Values_Len, but that is a REBVAL* interface
+    // !!! Should there be an Append_Values_Core which takes RELVAL*?
     //
-    REBCNT zombie = len;
-
-    REBCNT uncased = len; // uncased match not yet encountered
-
-    // Scan hash table for match:
+    const RELVAL *src = key;
+    REBCNT index;
+    for (index = 0; index < wide; ++src, ++index)
+        Append_Value_Core(array, src, specifier);
 
-    REBCNT *hashes = SER_HEAD(REBCNT, hashlist);
-    REBCNT n;
-    RELVAL *val;
-
-    if (ANY_WORD(key)) {
-        while ((n = hashes[hash])) {
-            val = ARR_AT(array, (n - 1) * wide);
-            if (ANY_WORD(val)) {
-                if (VAL_WORD_SPELLING(key) == VAL_WORD_SPELLING(val))
-                    return hash; // exact match
-
-                if (NOT(cased) && uncased == len) // not cased w/no match yet
-                    if (VAL_WORD_CANON(key) == VAL_WORD_CANON(val))
-                        uncased = hash; // indicate uncased match found
-            }
-            else if (wide > 1 && IS_VOID(++val) && zombie == len) {
-                zombie = hash;
-            }
-            hash += skip;
-            if (hash >= len) hash -= len;
-        }
-    }
-    else if (ANY_BINSTR(key)) {
-        while ((n = hashes[hash])) {
-            val = ARR_AT(array, (n - 1) * wide);
-            if (VAL_TYPE(val) == VAL_TYPE(key)) {
-                if (0 == Compare_String_Vals(val, key, FALSE)) return hash;
-                if (
-                    !cased && uncased == len
-                    && 0 == Compare_String_Vals(
-                        val, key, LOGICAL(!IS_BINARY(key))
-                    )
-                ) {
-                    uncased = hash;
-                }
-            }
-            if (wide > 1 && IS_VOID(++val) && zombie == len)  {
-                zombie = hash;
-            }
-            hash += skip;
-            if (hash >= len) hash -= len;
-        }
-    } else {
-        while ((n = hashes[hash])) {
-            val = ARR_AT(array, (n - 1) * wide);
-            if (VAL_TYPE(val) == VAL_TYPE(key)) {
-                if (0 == Cmp_Value(key, val, TRUE)) {
-                    return hash;
-                }
-                if (
-                    !cased && uncased == len
-                    && REB_CHAR == VAL_TYPE(val)
-                    && 0 == Cmp_Value(key, val, FALSE)
-                ) {
-                    uncased = hash;
-                }
-            }
-            if (wide > 1 && IS_VOID(++val) && zombie == len) zombie = hash;
-            hash += skip;
-            if (hash >= len) hash -= len;
-        }
-    }
+    return 0;
+}
 
-    //assert(n == 0);
-    if (!cased && uncased < len) hash = uncased; // uncased< match
-    else if (zombie < len) { // zombie encountered!
-        assert(mode == 0);
-        hash = zombie;
-        n = hashes[hash];
-        // new key overwrite zombie
-        Derelativize(ARR_AT(array, (n - 1) * wide), key, specifier);
-    }
-    // Append new value the target series:
-    if (mode > 1) {
-        REBCNT index;
-        const RELVAL *src = key;
-        hashes[hash] = (ARR_LEN(array) / wide) + 1;
-
-        // This used to use Append_Values_Len, but that is a REBVAL* interface
-        // !!! Should there be an Append_Values_Core which takes RELVAL*?
-        //
-        for (index = 0; index < wide; ++src, ++index)
-            Append_Value_Core(array, src, specifier);
-    }
 
-    return (mode > 0) ? NOT_FOUND : hash;
+//
+//  Add_Key_Hashed: C
+//
+// Add the key of record `n` to the hashlist, without checking if an equal
+// key is already in it.
+//
+void Add_Key_Hashed(REBSER *hashlist, const RELVAL *key, REBCNT n)
+{
+    Add_Hashed_Core(hashlist, Hash_Value(key), n);
 }
 
 
 //
 //  Rehash_Map: C
 //
-// Recompute the entire hash table for a map. Table must be large enough.
+// Squeeze the removed keys (those with void values) out of the pairlist and
+// recompute the entire hash table, growing it if it would be over a quarter
+// full.  That leaves room for the map to double before the next rehash.
 //
 static void Rehash_Map(REBMAP *map)
 {
@@ -209,66 +275,48 @@ static void Rehash_Map(REBMAP *map)
 
     if (!hashlist) return;
 
-    REBCNT *hashes = SER_HEAD(REBCNT, hashlist);
     REBARR *pairlist = MAP_PAIRLIST(map);
 
-    REBVAL *key = KNOWN(ARR_HEAD(pairlist));
-    REBCNT n;
-
-    for (n = 0; n < ARR_LEN(pairlist); n += 2, key += 2) {
-        const REBOOL cased = TRUE; // cased=TRUE is always fine
-
-        if (IS_VOID(key + 1)) {
-            //
-            // It's a "zombie", move last key to overwrite it
-            //
-            Move_Value(
-                key, KNOWN(ARR_AT(pairlist, ARR_LEN(pairlist) - 2))
-            );
-            Move_Value(
-                &key[1], KNOWN(ARR_AT(pairlist, ARR_LEN(pairlist) - 1))
-            );
-            SET_ARRAY_LEN_NOTERM(pairlist, ARR_LEN(pairlist) - 2);
-        }
-
-        REBCNT hash = Find_Key_Hashed(
-            pairlist, hashlist, key, SPECIFIED, 2, cased, 0
-        );
-        hashes[hash] = n / 2 + 1;
-
-        // discard zombies at end of pairlist
-        //
-        while (IS_VOID(ARR_AT(pairlist, ARR_LEN(pairlist) - 1))) {
-            SET_ARRAY_LEN_NOTERM(pairlist, ARR_LEN(pairlist) - 2);
+    REBVAL *src = KNOWN(ARR_HEAD(pairlist));
+    REBVAL *dest = src;
+    for (; NOT_END(src); src += 2) {
+        if (IS_VOID(src + 1))
+            continue; // removed key
+        if (dest != src) {
+            Move_Value(dest, src);
+            Move_Value(dest + 1, src + 1);
         }
+        dest += 2;
     }
-}
-
+    TERM_ARRAY_LEN(pairlist, cast(RELVAL*, dest) - ARR_HEAD(pairlist));
+
+    REBCNT count = ARR_LEN(pairlist) / 2;
+    if (count * 4 > SER_LEN(hashlist)) {
+        REBCNT size = SER_LEN(hashlist);
+        while (count * 4 > size) {
+            if (size >= (1u << 30)) {
+                DECLARE_LOCAL (temp);
+                Init_Integer(temp, count);
+                fail (Error_Size_Limit_Raw(temp));
+            }
+            size *= 2;
+        }
 
-//
-//  Expand_Hash: C
-//
-// Expand hash series. Clear it but set its tail.
-//
-void Expand_Hash(REBSER *ser)
-{
-    REBINT pnum = Get_Hash_Prime(SER_LEN(ser) + 1);
-    if (pnum == 0) {
-        DECLARE_LOCAL (temp);
-        Init_Integer(temp, SER_LEN(ser) + 1);
-        fail (Error_Size_Limit_Raw(temp));
+        assert(NOT_SER_FLAG(hashlist, SERIES_FLAG_ARRAY));
+        Remake_Series(
+            hashlist,
+            size + 1,
+            SER_WIDE(hashlist),
+            SERIES_FLAG_POWER_OF_2 // NOT(NODE_FLAG_NODE) => don't keep data
+        );
+        SET_SERIES_LEN(hashlist, size);
     }
+    Clear_Series(hashlist);
 
-    assert(NOT_SER_FLAG(ser, SERIES_FLAG_ARRAY));
-    Remake_Series(
-        ser,
-        pnum + 1,
-        SER_WIDE(ser),
-        SERIES_FLAG_POWER_OF_2 // NOT(NODE_FLAG_NODE) => don't keep data
-    );
-
-    Clear_Series(ser);
-    SET_SERIES_LEN(ser, pnum);
+    RELVAL *key = ARR_HEAD(pairlist);
+    REBCNT n;
+    for (n = 1; n <= count; ++n, key += 2)
+        Add_Hashed_Core(hashlist, Hash_Value(key), n);
 }
 
 
@@ -295,18 +343,14 @@ REBCNT Find_Map_Entry(
 
     assert(hashlist);
 
-    // Get hash table, expand it if needed:
-    if (ARR_LEN(pairlist) > SER_LEN(hashlist) / 2) {
-        Expand_Hash(hashlist); // modifies size value
+    // Keep the hashlist no more than half full.  Removed keys count against
+    // that until the rehash drops them, though their slots may be reused.
+    //
+    if (ARR_LEN(pairlist) >= SER_LEN(hashlist))
         Rehash_Map(map);
-    }
-
-    REBCNT hash = Find_Key_Hashed(
-        pairlist, hashlist, key, key_specifier, 2, cased, 0
-    );
 
-    REBCNT *hashes = SER_HEAD(REBCNT, hashlist);
-    REBCNT n = hashes[hash];
+    REBCNT hash = Hash_Value(key);
+    REBCNT n = Find_Hashed_Core(pairlist, hashlist, key, hash, 2, cased);
 
     // n==0 or pairlist[(n-1)*]=~key
 
@@ -331,6 +375,8 @@ REBCNT Find_Map_Entry(
             val,
             val_specifier
         );
+        if (IS_VOID(val)) // removed, the record is now a zombie
+            Remove_Hashed_Core(hashlist, hash, n);
         return n;
     }
 
@@ -342,7 +388,9 @@ REBCNT Find_Map_Entry(
     Append_Value_Core(pairlist, key, key_specifier);
     Append_Value_Core(pairlist, val, val_specifier);
 
-    return (hashes[hash] = (ARR_LEN(pairlist) / 2));
+    n = ARR_LEN(pairlist) / 2;
+    Add_Hashed_Core(hashlist, hash, n);
+    return n;
 }
 
 
@@ -475,7 +523,6 @@ void TO_Map(REBVAL *out, enum Reb_Kind kind, const REBVAL *arg)
 
     REBMAP *map = Make_Map(len / 2); // [key value key value...] + END
     Append_Map(map, array, index, specifier, len);
-    Rehash_Map(map);
     Init_Map(out, map);
 }
 
@@ -572,10 +572,13 @@ REBNATIVE(set_meta)
 
     REBVAL *v = ARG(value);
 
-    if (IS_FUNCTION(v))
+    if (IS_FUNCTION(v)) {
+        GC_Barrier_Write(VAL_FUNC_PARAMLIST(v));
         MISC(VAL_FUNC_PARAMLIST(v)).meta = meta;
+    }
     else {
         assert(ANY_CONTEXT(v));
+        GC_Barrier_Write(CTX_VARLIST(VAL_CONTEXT(v)));
         MISC(CTX_VARLIST(VAL_CONTEXT(v))).meta = meta;
     }
 
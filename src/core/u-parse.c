@@ -402,6 +402,18 @@ static const RELVAL *Get_Parse_Value(
 }
 
 
+// FORM a rule, to match it against string input.  The result is only needed
+// while matching, so it is made in the arena (see Push_Arena()).
+//
+static REBSER *Form_Rule_Arena(const RELVAL *rule)
+{
+    DECLARE_MOLD (mo);
+    Push_Mold(mo);
+    Form_Value(mo, rule);
+    return Pop_Molded_String_Arena(mo);
+}
+
+
 //
 //  Parse_String_One_Rule: C
 //
@@ -475,7 +487,8 @@ static REBIXO Parse_String_One_Rule(REBFRM *f, const RELVAL *rule) {
         // !!! The content to be matched does not have the delimiters in the
         // actual series data.  This FORMs it, but could be more optimized.
         //
-        REBSER *formed = Copy_Form_Value(rule, 0);
+        REBCNT arena = Push_Arena();
+        REBSER *formed = Form_Rule_Arena(rule);
         REBCNT index = Find_Str_Str(
             P_INPUT,
             0,
@@ -487,7 +500,7 @@ static REBIXO Parse_String_One_Rule(REBFRM *f, const RELVAL *rule) {
             SER_LEN(formed),
             flags
         );
-        Free_Series(formed);
+        Drop_Arena(arena);
         if (index == NOT_FOUND)
             return END_FLAG;
         return index; }
@@ -868,7 +881,8 @@ static REBIXO To_Thru_Block_Rule(
                         // !!! This code was adapted from Parse_to, and is
                         // inefficient in the sense that it forms the tag
                         //
-                        REBSER *formed = Copy_Form_Value(rule, 0);
+                        REBCNT arena = Push_Arena();
+                        REBSER *formed = Form_Rule_Arena(rule);
                         REBCNT len = SER_LEN(formed);
                         REBCNT i = Find_Str_Str(
                             P_INPUT,
@@ -881,7 +895,7 @@ static REBIXO To_Thru_Block_Rule(
                             len,
                             AM_FIND_MATCH | P_FIND_FLAGS
                         );
-                        Free_Series(formed);
+                        Drop_Arena(arena);
                         if (i != NOT_FOUND) {
                             pos = i;
                             if (is_thru) pos += len;
@@ -1039,7 +1053,8 @@ static REBIXO To_Thru_Non_Block_Rule(
     if (ANY_BINSTR(rule)) {
         if (!IS_STRING(rule) && !IS_BINARY(rule)) {
             // !!! Can this be optimized not to use COPY?
-            REBSER *formed = Copy_Form_Value(rule, 0);
+            REBCNT arena = Push_Arena();
+            REBSER *formed = Form_Rule_Arena(rule);
             REBCNT form_len = SER_LEN(formed);
             REBCNT i = Find_Str_Str(
                 P_INPUT,
@@ -1054,7 +1069,7 @@ static REBIXO To_Thru_Non_Block_Rule(
                     ? AM_FIND_CASE
                     : 0
             );
-            Free_Series(formed);
+            Drop_Arena(arena);
 
             if (i == NOT_FOUND)
                 return END_FLAG;
@@ -68,7 +68,8 @@
     REBNOD  *first;             // first free node in pool
     REBNOD  *last;              // last free node in pool
     REBCNT  wide;               // size of allocation unit
-    REBCNT  units;              // units per segment allocation
+    REBCNT  units;              // units in the next segment allocated
+    REBCNT  max_units;          // limit for growing `units`
     REBCNT  free;               // number of units remaining
     REBCNT  has;                // total number of units
 //  UL      total;              // total bytes for all segs
@@ -76,6 +77,12 @@
 //  UL      extra;              // reserved
 };
 
+// Fill_Pool() makes segments bigger for pools that keep running out, so the
+// segments of a pool don't all hold the same number of units.
+//
+#define SEG_UNITS(pool, seg) \
+    cast(REBCNT, ((seg)->size - sizeof(REBSEG)) / (pool)->wide)
+
 
 /***********************************************************************
 **
@@ -100,3 +107,40 @@
 #define MEM_BIG_SIZE 1024
 
 #define MEM_BALLAST 3000000
+
+// A pool's segments grow up to this multiple of its Mem_Pool_Spec units
+//
+#define MEM_POOL_MAX_GROWTH 16
+
+// Series data of at least MEM_MAP_SIZE is mmap()'d where mremap() exists,
+// and mappings of at least MEM_HUGE_PAGE_SIZE ask for transparent huge pages
+//
+#ifdef TO_LINUX
+    #define MEM_MAP_SERIES
+#endif
+
+#define MEM_MAP_SIZE (1024 * 1024)
+#define MEM_HUGE_PAGE_SIZE (2 * 1024 * 1024)
+
+
+/***********************************************************************
+**
+*/  struct Reb_Arena_Block
+/*
+**      Memory that Alloc_Arena() hands out by bumping `used`, see
+**      Push_Arena().  Positions in the arena are counted from the start
+**      of the first block, so `base` is where this block's payload starts.
+**
+***********************************************************************/
+{
+    struct Reb_Arena_Block *prev;
+    struct Reb_Arena_Block *next; // spare block kept after a drop, or NULL
+    REBCNT base;
+    REBCNT size;                // bytes of payload
+    REBCNT used;                // bytes of payload handed out
+};
+
+#define ARENA_BLOCK_HEADER \
+    ALIGN(sizeof(struct Reb_Arena_Block), sizeof(REBI64))
+
+#define ARENA_BLOCK_PAYLOAD (32 * 1024)
@@ -676,6 +676,16 @@ typedef struct sInt64 {
     #define DEAD_END
 #endif
 
+// PREFETCH is a hint that the memory at an address will be read soon, so
+// getting it into the cache can overlap with other work.  The address does
+// not have to be valid.  It's a no-op if the compiler has no such builtin.
+//
+#if __has_builtin(__builtin_prefetch) || GCC_VERSION_AT_LEAST(3, 1)
+    #define PREFETCH(p) __builtin_prefetch(p)
+#else
+    #define PREFETCH(p) NOOP
+#endif
+
 
 //=////////////////////////////////////////////////////////////////////////=//
 //
@@ -191,6 +191,9 @@ typedef u16 REBUNI;
     typedef unsigned int REBDSP;
     struct Reb_Chunk;
     struct Reb_Chunker;
+    struct Reb_Continuation;
+    struct Reb_Bytecode_Run;
+    struct Reb_Key_Index;
 
     struct Reb_Node;
     typedef struct Reb_Node REBNOD;
@@ -46,6 +46,15 @@
 // It's just a demonstration of where more general logic using atomics
 // that could work for N clients would be.
 //
+// Writing an index into every canon--and writing it again to clear it--is
+// cheap for the handful of keys in a function spec or small object, since
+// the word lookup has already brought the canon into cache.  But binding a
+// module body dirties the cache lines of thousands of symbols all over the
+// heap.  So once a binder has been given more than BINDER_MAX_STASH keys, it
+// moves their indices out of the canons and into an open-addressing table of
+// its own, keyed by canon pointer.  The table is an unmanaged series, so it
+// is freed automatically if a fail() interrupts the bind.
+//
 // The debug build also adds another feature, that makes sure the clear count
 // matches the set count.
 //
@@ -81,8 +90,43 @@ enum {
 };
 
 
+// Number of keys a binder stashes in the canons before switching to a table.
+//
+#define BINDER_MAX_STASH 32
+
+// Slots in a binder's table, indexed by Hash_Canon().  A slot whose canon was
+// removed keeps the canon with an index of 0, so the probe chains through it
+// stay intact.  These "tombstones" are dropped when the table is rehashed.
+//
+struct Reb_Binder_Slot {
+    REBSTR *canon; // NULL if slot was never used
+    REBINT index;
+};
+
+inline static REBCNT Hash_Canon(REBSTR *canon, REBCNT size) {
+    REBU64 h = cast(REBU64, cast(REBUPT, canon)) * 0x9E3779B97F4A7C15ULL;
+    return cast(REBCNT, h >> 32) & (size - 1);
+}
+
 struct Reb_Binder {
     REBOOL high;
+
+    // Until there are BINDER_MAX_STASH keys, the indices are in the canons,
+    // and the canons are remembered here so they can be moved to a table.
+    // (A canon removed and added again is remembered twice.)
+    //
+    REBCNT stashed;
+    REBSTR *stash[BINDER_MAX_STASH];
+
+    // Once there are more keys, this holds a table of Reb_Binder_Slot whose
+    // length is a power of 2.  Its used slots (tombstones included) are kept
+    // at no more than half of them.
+    //
+    REBSER *table; // NULL while the indices are in the canons
+    struct Reb_Binder_Slot *slots; // SER_HEAD() of table
+    REBCNT mask; // SER_LEN() of table, minus 1
+    REBCNT used;
+
 #if !defined(NDEBUG)
     REBCNT count;
 #endif
@@ -102,6 +146,8 @@ struct Reb_Binder {
 
 inline static void INIT_BINDER(struct Reb_Binder *binder) {
     binder->high = TRUE; //LOGICAL(SPORADICALLY(2)); sporadic?
+    binder->stashed = 0;
+    binder->table = NULL;
 
 #if !defined(NDEBUG)
     binder->count = 0;
@@ -114,9 +160,10 @@ inline static void INIT_BINDER(struct Reb_Binder *binder) {
 
 
 inline static void SHUTDOWN_BINDER(struct Reb_Binder *binder) {
-#ifdef NDEBUG
-    UNUSED(binder);
-#else
+    if (binder->table != NULL)
+        Free_Series(binder->table);
+
+#if !defined(NDEBUG)
     assert(binder->count == 0);
 
     #ifdef CPLUSPLUS_11
@@ -126,6 +173,97 @@ inline static void SHUTDOWN_BINDER(struct Reb_Binder *binder) {
 }
 
 
+// Find the slot for the canon in the binder's table, which is either the
+// slot holding it or the empty one where it would go.
+//
+inline static struct Reb_Binder_Slot *Binder_Slot(
+    struct Reb_Binder *binder,
+    REBSTR *canon
+){
+    struct Reb_Binder_Slot *slots = binder->slots;
+
+    REBCNT i = Hash_Canon(canon, binder->mask + 1);
+    while (slots[i].canon != canon && slots[i].canon != NULL)
+        i = (i + 1) & binder->mask;
+    return &slots[i];
+}
+
+
+// Make a new table for the binder with room for `len` keys, and move the
+// keys into it from the old table, if any.  Tombstones are left behind.
+//
+inline static void Rehash_Binder(struct Reb_Binder *binder, REBCNT len) {
+    REBCNT size = BINDER_MAX_STASH * 2;
+    while (size < len * 2)
+        size *= 2;
+
+    REBSER *old = binder->table;
+
+    binder->table = Make_Series(size + 1, sizeof(struct Reb_Binder_Slot));
+    Clear_Series(binder->table);
+    SET_SERIES_LEN(binder->table, size);
+    binder->slots = SER_HEAD(struct Reb_Binder_Slot, binder->table);
+    binder->mask = size - 1;
+    binder->used = 0;
+
+    if (old == NULL)
+        return;
+
+    struct Reb_Binder_Slot *slot = SER_HEAD(struct Reb_Binder_Slot, old);
+    REBCNT n;
+    for (n = 0; n < SER_LEN(old); ++n, ++slot) {
+        if (slot->index == 0)
+            continue;
+        *Binder_Slot(binder, slot->canon) = *slot;
+        ++binder->used;
+    }
+
+    Free_Series(old);
+}
+
+
+// Move the indices of the remembered canons into a table, for when there
+// are too many keys to keep stashing them in the canons.
+//
+inline static void Unstash_Binder(struct Reb_Binder *binder) {
+    assert(binder->table == NULL);
+    Rehash_Binder(binder, BINDER_MAX_STASH * 2);
+
+    REBCNT n;
+    for (n = 0; n < binder->stashed; ++n) {
+        REBSTR *canon = binder->stash[n];
+
+        REBINT index;
+        if (binder->high) {
+            index = MISC(canon).bind_index.high;
+            MISC(canon).bind_index.high = 0;
+        }
+        else {
+            index = MISC(canon).bind_index.low;
+            MISC(canon).bind_index.low = 0;
+        }
+        if (index == 0)
+            continue; // removed since, or remembered twice
+
+        struct Reb_Binder_Slot *slot = Binder_Slot(binder, canon);
+        slot->canon = canon;
+        slot->index = index;
+        ++binder->used;
+    }
+}
+
+
+// Callers that know how many keys they will add can say so after calling
+// INIT_BINDER(), so a large bind starts out in a table of the right size
+// instead of stashing into the canons and then growing a table.
+//
+inline static void Size_Binder(struct Reb_Binder *binder, REBCNT len) {
+    assert(binder->stashed == 0 && binder->table == NULL);
+    if (len > BINDER_MAX_STASH)
+        Rehash_Binder(binder, len);
+}
+
+
 // Tries to set the binder index, but return false if already there.
 //
 inline static REBOOL Try_Add_Binder_Index(
@@ -135,6 +273,28 @@ inline static REBOOL Try_Add_Binder_Index(
 ){
     assert(index != 0);
     assert(GET_SER_INFO(canon, STRING_INFO_CANON));
+
+    if (binder->table == NULL && binder->stashed == BINDER_MAX_STASH)
+        Unstash_Binder(binder);
+
+    if (binder->table != NULL) {
+        struct Reb_Binder_Slot *slot = Binder_Slot(binder, canon);
+        if (slot->canon != NULL) {
+            if (slot->index != 0)
+                return FALSE;
+            slot->index = index; // reuse the tombstone
+            goto added;
+        }
+        if ((binder->used + 1) * 2 > binder->mask + 1) {
+            Rehash_Binder(binder, binder->used * 2); // quadruple the size
+            slot = Binder_Slot(binder, canon);
+        }
+        slot->canon = canon;
+        slot->index = index;
+        ++binder->used;
+        goto added;
+    }
+
     if (binder->high) {
         if (MISC(canon).bind_index.high != 0)
             return FALSE;
@@ -145,7 +305,9 @@ inline static REBOOL Try_Add_Binder_Index(
             return FALSE;
         MISC(canon).bind_index.low = index;
     }
+    binder->stash[binder->stashed++] = canon;
 
+added:;
 #if !defined(NDEBUG)
     ++binder->count;
 #endif
@@ -174,6 +336,9 @@ inline static REBINT Get_Binder_Index_Else_0( // 0 if not present
 ){
     assert(GET_SER_INFO(canon, STRING_INFO_CANON));
 
+    if (binder->table != NULL)
+        return Binder_Slot(binder, canon)->index; // 0 if empty slot
+
     if (binder->high)
         return MISC(canon).bind_index.high;
     else
@@ -188,7 +353,14 @@ inline static REBINT Remove_Binder_Index_Else_0( // return old value if there
     assert(GET_SER_INFO(canon, STRING_INFO_CANON));
 
     REBINT old_index;
-    if (binder->high) {
+    if (binder->table != NULL) {
+        struct Reb_Binder_Slot *slot = Binder_Slot(binder, canon);
+        old_index = slot->index;
+        if (old_index == 0)
+            return 0;
+        slot->index = 0; // slot->canon stays, see Reb_Binder_Slot
+    }
+    else if (binder->high) {
         old_index = MISC(canon).bind_index.high;
         if (old_index == 0)
             return 0;
@@ -404,6 +576,46 @@ inline static REBVAL *Get_Var_Core(
 
     REBNOD *binding = VAL_BINDING(any_word);
 
+    // SPECIFIC BINDING to an OBJECT! or MODULE! (e.g. words in `lib` or
+    // `user`) is tested for first, and with one mask on the varlist's info
+    // bits.  Their variables are in a dynamic varlist which may be moved by
+    // Expand_Context(), but reading the data pointer here is no more work
+    // than checking a cached one would be.  Anything unusual, including a
+    // write to a read-only context, goes the long way.
+    //
+    if (
+        (binding->header.bits & (NODE_FLAG_CELL | ARRAY_FLAG_VARLIST))
+        == ARRAY_FLAG_VARLIST
+    ){
+        REBSER *varlist = cast(REBSER*, binding);
+        REBUPT mask = SERIES_INFO_HAS_DYNAMIC
+            | SERIES_INFO_INACCESSIBLE | CONTEXT_INFO_STACK;
+        if (flags & GETVAR_MUTABLE)
+            mask |= SERIES_INFO_FROZEN | SERIES_INFO_HOLD
+                | SERIES_INFO_PROTECTED;
+
+        if ((varlist->info.bits & mask) == SERIES_INFO_HAS_DYNAMIC) {
+            REBVAL *var = cast(REBVAL*, varlist->content.dynamic.data)
+                + VAL_WORD_INDEX(any_word);
+
+            assert(var == CTX_VAR(CTX(varlist), VAL_WORD_INDEX(any_word)));
+            assert(
+                VAL_WORD_CANON(any_word)
+                == VAL_KEY_CANON(
+                    CTX_KEY(CTX(varlist), VAL_WORD_INDEX(any_word))
+                )
+            );
+            assert(!THROWN(var));
+
+            if (
+                NOT(flags & GETVAR_MUTABLE)
+                || NOT_VAL_FLAG(var, CELL_FLAG_PROTECTED)
+            ){
+                return var;
+            }
+        }
+    }
+
     if (binding->header.bits & NODE_FLAG_CELL) {
         //
         // DIRECT BINDING: This will be the case hit when a REBFRM* is used
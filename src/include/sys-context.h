@@ -121,11 +121,13 @@ inline static REBARR *CTX_KEYLIST(REBCTX *c) {
 
 static inline void INIT_CTX_KEYLIST_SHARED(REBCTX *c, REBARR *keylist) {
     SET_SER_INFO(keylist, SERIES_INFO_SHARED_KEYLIST);
+    GC_Barrier_Write(CTX_VARLIST(c)); // e.g. expanding an old context
     LINK(CTX_VARLIST(c)).keysource = NOD(keylist);
 }
 
 static inline void INIT_CTX_KEYLIST_UNIQUE(REBCTX *c, REBARR *keylist) {
     assert(NOT_SER_INFO(keylist, SERIES_INFO_SHARED_KEYLIST));
+    GC_Barrier_Write(CTX_VARLIST(c)); // e.g. expanding an old context
     LINK(CTX_VARLIST(c)).keysource = NOD(keylist);
 }
 
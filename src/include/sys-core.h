@@ -254,10 +254,13 @@ typedef struct rebol_mold {
     Drop_Mold_Core((mo), FALSE)
 
 #define Pop_Molded_String(mo) \
-    Pop_Molded_String_Core((mo), UNKNOWN)
+    Pop_Molded_String_Core((mo), UNKNOWN, FALSE)
 
 #define Pop_Molded_String_Len(mo,len) \
-    Pop_Molded_String_Core((mo), (len))
+    Pop_Molded_String_Core((mo), (len), FALSE)
+
+#define Pop_Molded_String_Arena(mo) \
+    Pop_Molded_String_Core((mo), UNKNOWN, TRUE)
 
 #define Mold_Value(mo,v) \
     Mold_Or_Form_Value((mo), (v), FALSE)
@@ -271,6 +274,9 @@ typedef struct rebol_mold {
 #define Copy_Form_Value(v,opts) \
     Copy_Mold_Or_Form_Value((v), (opts), TRUE)
 
+#define Copy_String_Slimming(src,index,length) \
+    Copy_String_Slimming_Core((src), (index), (length), FALSE)
+
 
 /***********************************************************************
 **
@@ -503,7 +509,12 @@ enum rebol_signals {
 
     // SIG_EVENT_PORT is to-be-documented
     //
-    SIG_EVENT_PORT = 1 << 3
+    SIG_EVENT_PORT = 1 << 3,
+
+    // SIG_SAMPLE means the PROFILE timer has gone off, and the stack should
+    // be recorded (see Sample_Stack())
+    //
+    SIG_SAMPLE = 1 << 4
 };
 
 // Security flags:
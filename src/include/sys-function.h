@@ -121,6 +121,19 @@ inline static REBCTX *FUNC_META(REBFUN *f) {
 #define FUNC_FACADE_HEAD(f) \
     KNOWN(ARR_AT(FUNC_FACADE(f), 1))
 
+// Debug builds give natives a RETURN parameter which release builds don't
+// have (see FUNC_FLAG_RETURN_DEBUG), so code recognizing a native by how
+// many parameters it takes should count them with this.
+//
+#if defined(NDEBUG)
+    #define FUNC_FACADE_NUM_RELEASE_PARAMS(f) \
+        FUNC_FACADE_NUM_PARAMS(f)
+#else
+    #define FUNC_FACADE_NUM_RELEASE_PARAMS(f) \
+        (FUNC_FACADE_NUM_PARAMS(f) \
+            - (GET_FUN_FLAG((f), FUNC_FLAG_RETURN_DEBUG) ? 1 : 0))
+#endif
+
 
 // The concept of the "underlying" function is that which has the right
 // number of arguments for the frame to be built--and which has the actual
@@ -241,6 +254,12 @@ inline static REBRIN *FUNC_ROUTINE(REBFUN *f) {
     #define FUNC_FLAG_RETURN_DEBUG FUNC_FLAG(7)
 #endif
 
+// Set on functions with entry points specialized for the types of their
+// first two arguments, see Register_Typed_Entry().  Copies of the function's
+// paramlist carry it too, so Apply_Core() still has to check the dispatcher.
+//
+#define FUNC_FLAG_TYPED_ENTRIES FUNC_FLAG(8)
+
 // These are the flags which are scanned for and set during Make_Function
 //
 #define FUNC_FLAG_CACHED_MASK \
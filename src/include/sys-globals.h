@@ -58,10 +58,8 @@ PVAR REBU64 PG_Mem_Limit;   // Memory limit set by SECURE
 //
 PVAR REBSTR *PG_Symbol_Canons; // Canon symbol pointers for words in %words.r
 PVAR REBSTR *PG_Canons_By_Hash; // Canon REBSER pointers indexed by hash
-PVAR REBCNT PG_Num_Canon_Slots_In_Use; // Total canon hash slots (+ deleteds)
-#if !defined(NDEBUG)
-    PVAR REBCNT PG_Num_Canon_Deleteds; // Deleted canon hash slots "in use"
-#endif
+PVAR REBCNT PG_Num_Canon_Slots_In_Use; // Total canon hash slots in use
+PVAR REBCNT PG_Canon_Epoch; // Bumped when a synonym takes over as canon
 
 //-- Main contexts:
 PVAR REBARR *PG_Root_Array; // Frame that holds Root_Vars
@@ -137,6 +135,21 @@ TVAR REBINT GC_Ballast;     // Bytes allocated to force automatic GC
 TVAR REBOOL GC_Disabled;      // TRUE when RECYCLE/OFF is run
 TVAR REBSER *GC_Guarded; // A stack of GC protected series and values
 PVAR REBSER *GC_Mark_Stack; // Series pending to mark their reachables as live
+TVAR REBOOL GC_Generational; // TRUE when RECYCLE/GENERATIONAL is on
+TVAR REBOOL GC_Major_Pending; // Next recycle must be a full one
+TVAR REBSER *GC_Nursery; // Nodes managed since the last recycle (generational)
+TVAR REBSER *GC_Watched; // Old nodes whose writes the card table tracks
+TVAR REBYTE *GC_Cards; // Dirty flags set by GC_Barrier_Write()
+TVAR REBSER *GC_Pinned; // Young nodes referenced from unscanned old arrays
+TVAR REBCNT GC_Old_Count; // Old nodes that survived the last full recycle
+TVAR REBCNT GC_Promoted; // Nodes promoted by minor recycles since then
+TVAR REBCNT GC_Pause_Budget; // Microseconds per sweep slice, 0 if not sliced
+TVAR REBOOL GC_Sweeping; // TRUE while a sliced sweep is still pending
+TVAR REBSER *GC_Black; // Nodes managed (or revived) while GC_Sweeping
+TVAR REBARR *GC_Varlist_Cache; // Dead frame varlists kept for reuse
+TVAR REBCNT GC_Pool_Slack; // Spare pool space kept, percent of the used
+TVAR REBI64 GC_Compacted; // Bytes freed by RECYCLE/COMPACT, in all builds
+TVAR REBUPT GC_Epoch; // Bumped by each recycle, see %c-bytecode.c
 TVAR REBSER **Prior_Expand; // Track prior series expansions (acceleration)
 
 TVAR REBSER *TG_Mold_Stack; // Used to prevent infinite loop in cyclical molds
@@ -146,6 +159,8 @@ TVAR REBSER *TG_Mold_Stack; // Used to prevent infinite loop in cyclical molds
 // would represent a memory leak in the release build.
 TVAR REBSER *GC_Manuals;    // Manually memory managed (not by GC)
 
+TVAR struct Reb_Arena_Block *TG_Arena; // Top block of the temporaries arena
+
 TVAR REBUPT Stack_Limit;    // Limit address for CPU stack.
 
 #if !defined(NDEBUG)
@@ -182,6 +197,16 @@ TVAR struct Reb_Chunk *TG_Top_Chunk;
 TVAR struct Reb_Chunk *TG_Head_Chunk;
 TVAR struct Reb_Chunker *TG_Root_Chunker;
 
+// Calls run by the caller's bytecode instead of nesting on the C stack have
+// their frames in a stack of continuations, see %c-bytecode.c
+//
+TVAR struct Reb_Continuation *TG_Continuation;
+
+// Bodies being run by Run_Bytecode_Throws(), so errors can tell where in
+// them it is, see %c-bytecode.c
+//
+TVAR struct Reb_Bytecode_Run *TG_Bytecode_Run;
+
 TVAR struct Reb_State *Saved_State; // Saved state for Catch (CPU state, etc.)
 
 #if !defined(NDEBUG)
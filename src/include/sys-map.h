@@ -47,6 +47,30 @@ struct Reb_Map {
     struct Reb_Array pairlist; // hashlist is held in ->link.hashlist
 };
 
+// The hashlist is a power-of-2 sized table, searched with linear probing in
+// "Robin Hood" order: a key which is further from its home slot than the
+// one in the way takes that slot, and the displaced key moves on.  So a
+// search can stop at the first key that is closer to home than it would
+// be, and probe lengths stay short even with the table half full.
+//
+// Each slot keeps the full hash of its key next to the record number, so
+// only keys whose hashes match are fetched from the array and compared.
+//
+// Removing a key sets its value to void, leaving a "zombie" record in the
+// pairlist so the record numbers in the hashlist stay valid.  The key's slot
+// becomes a tombstone: it keeps its hash, so the Robin Hood order of the
+// slots around it still holds, but its record number is REMOVED_SLOT.  So
+// lookups go past it, and the next key added whose probe reaches it (at a
+// point where the key could take it) reuses the slot.  Zombie records are
+// squeezed out when the hashlist fills up and Rehash_Map() rebuilds it.
+//
+struct Reb_Hash_Slot {
+    REBCNT n; // 1-based record number in the array, 0 if slot is empty
+    REBCNT hash; // Hash_Value() of the record's key, mixed (see %t-map.c)
+};
+
+#define REMOVED_SLOT MAX_U32 // `n` of a tombstone slot, see above
+
 inline static REBARR *MAP_PAIRLIST(REBMAP *m) {
     assert(GET_SER_FLAG(&(m)->pairlist, ARRAY_FLAG_PAIRLIST));
     return (&(m)->pairlist);
@@ -56,7 +80,7 @@ inline static REBARR *MAP_PAIRLIST(REBMAP *m) {
     (LINK(MAP_PAIRLIST(m)).hashlist)
 
 #define MAP_HASHES(m) \
-    SER_HEAD(MAP_HASHLIST(m))
+    SER_HEAD(struct Reb_Hash_Slot, MAP_HASHLIST(m))
 
 inline static REBMAP *MAP(void *p) {
     REBARR *a = ARR(p);
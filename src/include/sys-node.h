@@ -45,3 +45,22 @@ inline static REBNOD *NOD(void *p) {
     );
     return n;
 }
+
+
+// With RECYCLE/GENERATIONAL, a minor recycle only rescans the old nodes that
+// may have been made to refer to young ones since the last recycle.  So any
+// write of a node reference into a cell (or into a series node's LINK() or
+// MISC()) has to go through this barrier.  It flags the 512-byte "card" of
+// memory holding the written address as dirty, without needing to know what
+// array the cell belongs to.  Cards are folded into a fixed-size table, so
+// two far apart addresses may share a flag--that only costs a rescan.
+//
+// See Queue_Remembered_Nodes() for how dirty cards are matched to old nodes.
+//
+#define GC_CARD_SHIFT 9
+#define GC_NUM_CARDS (1 << 16)
+
+inline static void GC_Barrier_Write(const void *p) {
+    if (GC_Generational)
+        GC_Cards[(cast(REBUPT, p) >> GC_CARD_SHIFT) & (GC_NUM_CARDS - 1)] = 1;
+}
@@ -431,6 +431,38 @@
     FLAGIT_LEFT(12)
 
 
+//=//// SERIES_INFO_ARENA /////////////////////////////////////////////////=//
+//
+// The node and data of this series were bump-allocated together by
+// Make_Arena_Series(), and will be released by the Drop_Arena() matching the
+// Push_Arena() they were made under.  Such series are never in GC_Manuals,
+// and may not be freed with Free_Series() or handed to the GC.
+//
+#define SERIES_INFO_ARENA \
+    FLAGIT_LEFT(13)
+
+
+//=//// ARRAY_INFO_BYTECODE ///////////////////////////////////////////////=//
+//
+// The array is the body of an interpreted function which was called often
+// enough to be looked at by the bytecode compiler (see %c-bytecode.c).  The
+// result is kept in a table keyed by the array, and is freed along with it
+// by GC_Kill_Series().
+//
+#define ARRAY_INFO_BYTECODE \
+    FLAGIT_LEFT(14)
+
+
+//=//// KEYLIST_INFO_INDEXED //////////////////////////////////////////////=//
+//
+// The keylist is long enough that Find_Canon_In_Context() built a hash index
+// for it, which is held in LINK().key_index.  Contexts sharing the keylist
+// share the index, and it is freed with the keylist by GC_Kill_Series().
+//
+#define KEYLIST_INFO_INDEXED \
+    FLAGIT_LEFT(15)
+
+
 // ^-- STOP AT FLAGIT_LEFT(15) --^
 //
 // The rightmost 16 bits of the series info is used to store an 8 bit length
@@ -438,7 +470,7 @@
 // flags need to stop at FLAGIT_LEFT(15).
 //
 #ifdef CPLUSPLUS_11
-    static_assert(13 < 16, "SERIES_INFO_XXX too high");
+    static_assert(15 < 16, "SERIES_INFO_XXX too high");
 #endif
 
 
@@ -619,6 +651,11 @@ union Reb_Series_Link {
     //
     REBSER *hashlist;
 
+    // Object keylists with KEYLIST_INFO_INDEXED use this (paramlists have
+    // a facade instead, and are not indexed).
+    //
+    struct Reb_Key_Index *key_index;
+
     // for STRUCT, this is a "REBFLD" array.  It parallels an object's
     // keylist, giving not only names of the fields in the structure but
     // also the types and sizes.
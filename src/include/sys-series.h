@@ -608,6 +608,26 @@ inline static void Drop_Guard_Value_Common(const RELVAL *v) {
         Drop_Guard_Value_Debug(v, __FILE__, __LINE__);
 #endif
 
+// With RECYCLE/GENERATIONAL, minor recycles don't rescan old arrays that
+// were deeply frozen.  Code that writes references into an array despite it
+// being frozen (e.g. BIND) must use this on the node it is referencing.
+// Young nodes are the unmarked ones--old nodes keep their mark between GCs.
+//
+inline static void GC_Barrier_Node(REBNOD *node) {
+    if (GC_Generational && NOT(node->header.bits & NODE_FLAG_MARKED))
+        Pin_Young_Node(node);
+}
+
+// Bookkeeping for a node the GC just took responsibility for, which is only
+// needed by the optional recycling modes.
+//
+inline static void Note_Newly_Managed(REBNOD *node) {
+    if (GC_Generational)
+        Track_Young_Node(node);
+    else if (GC_Sweeping)
+        Mark_Node_Black(node);
+}
+
 
 //=////////////////////////////////////////////////////////////////////////=//
 //
@@ -48,11 +48,14 @@ struct Reb_State {
 
     REBDSP dsp;
     struct Reb_Chunk *top_chunk;
+    struct Reb_Continuation *continuation;
+    struct Reb_Bytecode_Run *bytecode_run;
     REBFRM *frame;
     REBCNT guarded_len;
     REBCTX *error;
 
     REBCNT manuals_len; // Where GC_Manuals was when state started
+    REBCNT arena_mark; // What Push_Arena() would have given back
     REBCNT uni_buf_len;
     REBCNT mold_loop_tail;
 };
@@ -91,6 +91,13 @@
 // and siglongjmp, are defined by POSIX.1. These two functions should always
 // be used when branching from a signal handler."
 //
+// The interpreter never jumps from a signal handler: a Ctrl-C only sets a
+// flag which the evaluator polls, and the fail() comes from there.  So the
+// mask isn't saved.  Saving it costs a sigprocmask() system call on every
+// PUSH_TRAP, which dominated the cost of TRAP and ATTEMPT on code that
+// doesn't fail.  (It would also be wrong for the signal port, which blocks
+// signals while it is open...a trapped error shouldn't unblock them.)
+//
 // Note: longjmp is able to pass a value (though only an integer on 64-bit
 // platforms, and not enough to pass a pointer).  This can be used to
 // dictate the value setjmp returns in the longjmp case, though the code
@@ -108,10 +115,17 @@
 //
 #ifdef HAS_POSIX_SIGNAL
     #define SET_JUMP(s) \
-        sigsetjmp((s), 1)
+        sigsetjmp((s), 0)
 
     #define LONG_JUMP(s,v) \
         siglongjmp((s), (v))
+#elif defined(TO_OSX) || defined(TO_FREEBSD) || defined(TO_NETBSD) \
+    || defined(TO_OPENBSD)
+    #define SET_JUMP(s) \
+        _setjmp(s) /* plain setjmp saves the signal mask on these */
+
+    #define LONG_JUMP(s,v) \
+        _longjmp((s), (v))
 #else
     #define SET_JUMP(s) \
         setjmp(s)
@@ -400,11 +400,27 @@
 #define HEADERIZE_KIND(kind) \
     FLAGBYTE_RIGHT(kind)
 
+// The payload of a cell reset to one of these kinds can't refer to a node,
+// so the reset needn't go through GC_Barrier_Write().  The kind is usually a
+// constant, which lets the test fold away for e.g. Init_Integer().
+//
+inline static REBOOL Kind_Has_No_Node(enum Reb_Kind kind) {
+    return LOGICAL(
+        (kind >= REB_BAR && kind <= REB_CHAR)
+        || (kind >= REB_TUPLE && kind <= REB_DATE)
+        || kind == REB_TYPESET
+        || kind > REB_LIBRARY
+    );
+}
+
 inline static void VAL_RESET_HEADER_common( // don't call directly
     RELVAL *v,
     enum Reb_Kind kind,
     REBUPT extra_flags
 ) {
+    if (NOT(Kind_Has_No_Node(kind)))
+        GC_Barrier_Write(v); // payload may be set to a node after the reset
+
     v->header.bits &= CELL_MASK_RESET;
     v->header.bits |= HEADERIZE_KIND(kind) | extra_flags;
 }
@@ -1584,6 +1600,7 @@ inline static void INIT_BINDING(RELVAL *v, void *p) {
     // !!! might be nice to do more checks here, may have to break this out
     // into a _Debug function in %c-value.c
 
+    GC_Barrier_Write(v);
     v->extra.binding = binding;
 }
 
@@ -1596,6 +1613,7 @@ inline static void Move_Value_Header(RELVAL *out, const RELVAL *v)
     );
 
     ASSERT_CELL_WRITABLE(out, __FILE__, __LINE__);
+    GC_Barrier_Write(out); // Move_Value() and Derelativize() copy payloads
 
     out->header.bits &= CELL_MASK_RESET;
     out->header.bits |= v->header.bits & CELL_MASK_COPY;
@@ -1710,6 +1728,7 @@ inline static REBVAL *Move_Var(RELVAL *out, const REBVAL *v)
     ASSERT_CELL_WRITABLE(out, __FILE__, __LINE__);
 
     assert(NOT(out->header.bits & VALUE_FLAG_STACK));
+    GC_Barrier_Write(out);
 
     // !!! We preserve VALUE_FLAG_ENFIXED, but should we preserve protection
     // status as well?
@@ -1749,6 +1768,7 @@ inline static void Blit_Cell(RELVAL *out, const RELVAL *v)
         == (v->header.bits & CELL_MASK_RESET)
     );
 
+    GC_Barrier_Write(out);
     out->header = v->header;
     out->payload = v->payload;
     out->extra = v->extra;